@@ -0,0 +1,48 @@
+#ifndef BOWLINGSIMULATOR_BENCH_H
+#define BOWLINGSIMULATOR_BENCH_H
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory_resource>
+
+class Bench {
+public:
+    using Fn = void (*)();
+
+    static int Register(const char* name, Fn fn);
+
+    static int RunAll(const char* filter);
+
+    template <typename F>
+    static double Measure(const char* label, std::size_t operations, F&& fn) {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << "  " << label << ": " << elapsed.count() * 1e3 << " ms, "
+                  << elapsed.count() * 1e9 / operations << " ns/op\n";
+        return elapsed.count();
+    }
+};
+
+// Counts the calls that reach an upstream resource, e.g. the heap behind a pool or arena.
+class CountingResource : public std::pmr::memory_resource {
+    std::pmr::memory_resource* upstream;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+public:
+    std::size_t allocations = 0;
+    std::size_t bytes = 0;
+
+    explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+};
+
+#define BENCH(name) \
+    static void name(); \
+    static const int name##Registered = Bench::Register(#name, name); \
+    static void name()
+
+#endif //BOWLINGSIMULATOR_BENCH_H
@@ -0,0 +1,36 @@
+#include "Bench.h"
+
+#include "FrameSet.h"
+#include "PinSet.h"
+
+#include <array>
+#include <random>
+
+#ifndef BOWLINGSIMULATOR_CONFIGURATION
+#define BOWLINGSIMULATOR_CONFIGURATION "unknown"
+#endif
+
+static constexpr std::size_t games = 1'000'000;
+
+// The virtual-call heavy FrameSet path, to compare release, LTO and PGO builds;
+// bench/CompareConfigurations.sh builds each preset and runs this.
+BENCH(Configurations) {
+    std::array<PinSet, 11> balls;
+    for (auto i = 0; i < 11; ++i)
+        for (auto pin = 0; pin < i; ++pin)
+            balls[i].KnockDownPin(static_cast<Pin>(pin));
+
+    std::mt19937_64 rng{33};
+    uint_fast64_t total = 0;
+    std::cout << "  configuration: " << BOWLINGSIMULATOR_CONFIGURATION << "\n";
+    const auto seconds = Bench::Measure("FrameSet game, per game", games, [&] {
+        for (std::size_t game = 0; game < games; ++game) {
+            FrameSet frameSet{};
+            while (!frameSet.Ended())
+                frameSet.Bowled(balls[rng() % 11]);
+            total += frameSet.Score();
+        }
+    });
+    std::cout << "  " << games / seconds << " games/s, average score "
+              << static_cast<double>(total) / games << "\n";
+}
@@ -0,0 +1,78 @@
+#include "Bench.h"
+
+#include "FrameSet.h"
+#include "GameArena.h"
+#include "PinSet.h"
+
+#include <array>
+#include <random>
+#include <vector>
+
+static constexpr std::size_t gamesPerBatch = 10'000;
+static constexpr std::size_t batches = 20;
+
+static std::array<PinSet, 11> MakeBalls() {
+    std::array<PinSet, 11> balls;
+    for (auto i = 0; i < 11; ++i)
+        for (auto pin = 0; pin < i; ++pin)
+            balls[i].KnockDownPin(static_cast<Pin>(pin));
+    return balls;
+}
+
+static uint_fast64_t PlayBatch(std::vector<FrameSet>& games, const std::array<PinSet, 11>& balls,
+                               std::mt19937_64& rng) {
+    uint_fast64_t total = 0;
+    for (auto& i : games) {
+        while (!i.Ended())
+            i.Bowled(balls[rng() % 11]);
+        total += i.Score();
+    }
+    return total;
+}
+
+BENCH(GameArenaVersusHeap) {
+    const auto balls = MakeBalls();
+    std::vector<FrameSet> games;
+    games.reserve(gamesPerBatch);
+
+    {
+        CountingResource heap;
+        std::mt19937_64 rng{7};
+        uint_fast64_t total = 0;
+        Bench::Measure("heap-allocated games, per game", gamesPerBatch * batches, [&] {
+            for (std::size_t batch = 0; batch < batches; ++batch) {
+                for (std::size_t i = 0; i < gamesPerBatch; ++i)
+                    games.emplace_back(&heap);
+                total += PlayBatch(games, balls, rng);
+                games.clear();
+            }
+        });
+        std::cout << "  heap: " << static_cast<double>(heap.allocations) / (gamesPerBatch * batches)
+                  << " allocator calls per game, average score "
+                  << static_cast<double>(total) / (gamesPerBatch * batches) << "\n";
+    }
+
+    {
+        CountingResource heap;
+        GameArena arena{gamesPerBatch, &heap};
+        std::mt19937_64 rng{7};
+        uint_fast64_t total = 0;
+        std::size_t steadyStateAllocations = 0;
+        Bench::Measure("arena-allocated games, per game", gamesPerBatch * batches, [&] {
+            for (std::size_t batch = 0; batch < batches; ++batch) {
+                const auto before = heap.allocations;
+                for (std::size_t i = 0; i < gamesPerBatch; ++i)
+                    games.emplace_back(arena.Resource());
+                total += PlayBatch(games, balls, rng);
+                games.clear();
+                arena.Reset();
+                if (batch)
+                    steadyStateAllocations += heap.allocations - before;
+            }
+        });
+        std::cout << "  arena: " << GameArena::BytesPerGame() << " bytes per game, "
+                  << static_cast<double>(steadyStateAllocations) / (gamesPerBatch * (batches - 1))
+                  << " allocator calls per game after the first batch, average score "
+                  << static_cast<double>(total) / (gamesPerBatch * batches) << "\n";
+    }
+}
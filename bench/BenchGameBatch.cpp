@@ -0,0 +1,38 @@
+#include "Bench.h"
+
+#include "GameBatch.h"
+
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+
+static constexpr std::size_t games = 1'000'000;
+static constexpr std::size_t rounds = 21;
+
+BENCH(GameBatchThroughput) {
+    std::mt19937_64 rng{99};
+    std::vector<std::vector<PinMask>> balls(rounds, std::vector<PinMask>(games));
+    for (auto& round : balls)
+        for (auto& i : round)
+            i = static_cast<PinMask>(rng() & 0x3FF);
+
+    const auto threads = std::max(1u, std::thread::hardware_concurrency());
+    for (auto workers = 1u; workers <= threads; workers *= 2) {
+        const auto perShard = (games + workers - 1) / workers;
+        std::vector<GameBatch> shards;
+        for (auto w = 0u; w < workers; ++w)
+            shards.emplace_back(std::min(perShard, games - std::min(games, w * perShard)));
+        const auto seconds = Bench::Measure("1M games x 21 balls, per ball", games * rounds, [&] {
+            std::vector<std::thread> pool;
+            for (auto w = 0u; w < workers; ++w)
+                pool.emplace_back([&, w] {
+                    for (const auto& round : balls)
+                        shards[w].BowlAll(std::span<const PinMask>{round}.subspan(w * perShard, shards[w].Size()));
+                });
+            for (auto& i : pool)
+                i.join();
+        });
+        std::cout << "  " << workers << " thread(s): " << games * rounds / seconds / 1e9 << " billion balls/s\n";
+    }
+}
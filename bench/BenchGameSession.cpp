@@ -0,0 +1,104 @@
+#include "Bench.h"
+
+#include "FrameSet.h"
+#include "GameSession.h"
+#include "PinSet.h"
+
+#include <array>
+#include <functional>
+#include <random>
+#include <vector>
+
+static constexpr std::size_t sessions = 10'000;
+
+static std::array<PinSet, 11> MakeBalls() {
+    std::array<PinSet, 11> balls;
+    for (auto i = 0; i < 11; ++i)
+        for (auto pin = 0; pin < i; ++pin)
+            balls[i].KnockDownPin(static_cast<Pin>(pin));
+    return balls;
+}
+
+class CallbackSession {
+    InlineFrameSet& frameSet;
+    std::function<void(const ScoreUpdate&)> onUpdate;
+    uint_fast8_t turn = 0;
+
+public:
+    CallbackSession(InlineFrameSet& frameSet, std::function<void(const ScoreUpdate&)> onUpdate)
+            : frameSet{frameSet}, onUpdate{std::move(onUpdate)} {
+    }
+
+    void Bowled(const IPinSet& pins) {
+        const auto frame = frameSet.CurrentFrame();
+        frameSet.Bowled(pins);
+        onUpdate({frame, ++turn, frameSet.Score(), frameSet.Ended()});
+    }
+
+    bool Ended() const {
+        return frameSet.Ended();
+    }
+};
+
+BENCH(GameSessionCoroutineVsCallback) {
+    const auto balls = MakeBalls();
+    std::size_t totalBalls = 0;
+    uint_fast64_t checksum = 0;
+
+    {
+        std::vector<InlineFrameSet> frameSets;
+        frameSets.reserve(sessions);
+        for (std::size_t i = 0; i < sessions; ++i)
+            frameSets.emplace_back();
+        CountingResource heap;
+        std::pmr::unsynchronized_pool_resource pool{&heap};
+        std::vector<GameSession> games;
+        games.reserve(sessions);
+        for (auto& i : frameSets)
+            games.push_back(GameSession::Play(std::allocator_arg, pool, i));
+        const auto setupAllocations = heap.allocations;
+        std::mt19937_64 rng{42};
+        Bench::Measure("coroutine sessions, per game", sessions, [&] {
+            for (auto active = sessions; active;) {
+                active = 0;
+                for (auto& i : games) {
+                    if (i.Ended())
+                        continue;
+                    checksum += i.Bowled(balls[rng() % 11]).score;
+                    ++totalBalls;
+                    ++active;
+                }
+            }
+        });
+        std::cout << "  coroutine frames: " << setupAllocations << " upstream allocations for " << sessions
+                  << " sessions, " << heap.allocations - setupAllocations << " while bowling "
+                  << totalBalls << " balls\n";
+    }
+
+    {
+        std::vector<InlineFrameSet> frameSets;
+        frameSets.reserve(sessions);
+        for (std::size_t i = 0; i < sessions; ++i)
+            frameSets.emplace_back();
+        std::vector<CallbackSession> games;
+        games.reserve(sessions);
+        uint_fast64_t callbackChecksum = 0;
+        for (auto& i : frameSets)
+            games.emplace_back(i, [&callbackChecksum](const ScoreUpdate& update) {
+                callbackChecksum += update.score;
+            });
+        std::mt19937_64 rng{42};
+        Bench::Measure("callback sessions, per game", sessions, [&] {
+            for (auto active = sessions; active;) {
+                active = 0;
+                for (auto& i : games) {
+                    if (i.Ended())
+                        continue;
+                    i.Bowled(balls[rng() % 11]);
+                    ++active;
+                }
+            }
+        });
+        std::cout << "  checksums " << (checksum == callbackChecksum ? "match" : "DIFFER") << "\n";
+    }
+}
@@ -0,0 +1,55 @@
+#include "Bench.h"
+
+#include "FrameSet.h"
+#include "GameStateTable.h"
+#include "PinSet.h"
+
+#include <array>
+#include <random>
+
+static constexpr std::size_t games = 1'000'000;
+
+// Count-only games where each ball knocks down a uniform number of the pins still standing.
+BENCH(GameStateTableVersusFrameSet) {
+    std::array<PinSet, 11> balls;
+    for (auto i = 0; i < 11; ++i)
+        for (auto pin = 0; pin < i; ++pin)
+            balls[i].KnockDownPin(static_cast<Pin>(pin));
+
+    {
+        std::mt19937_64 rng{32};
+        uint_fast64_t total = 0;
+        Bench::Measure("FrameSet, per game", games / 10, [&] {
+            for (std::size_t game = 0; game < games / 10; ++game) {
+                FrameSet frameSet{};
+                uint_fast8_t standing = 10;
+                while (!frameSet.Ended()) {
+                    const auto pins = rng() % (standing + 1);
+                    const auto frame = frameSet.CurrentFrame();
+                    frameSet.Bowled(balls[10 - standing + pins]);
+                    standing -= pins;
+                    if (!standing || frameSet.CurrentFrame() != frame)
+                        standing = 10;
+                }
+                total += frameSet.Score();
+            }
+        });
+        std::cout << "  average score " << static_cast<double>(total) / (games / 10) << "\n";
+    }
+
+    {
+        std::mt19937_64 rng{32};
+        uint_fast64_t total = 0;
+        Bench::Measure("GameStateTable, per game", games, [&] {
+            for (std::size_t game = 0; game < games; ++game) {
+                auto state = GameStateTable::start;
+                while (state != GameStateTable::end) {
+                    const auto pins = rng() % (GameStateTable::standing[state] + 1);
+                    total += GameStateTable::points[state][pins];
+                    state = GameStateTable::next[state][pins];
+                }
+            }
+        });
+        std::cout << "  average score " << static_cast<double>(total) / games << "\n";
+    }
+}
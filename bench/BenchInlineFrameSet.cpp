@@ -0,0 +1,71 @@
+#include "Bench.h"
+
+#include "FrameSet.h"
+#include "GameArena.h"
+#include "PinSet.h"
+
+#include <random>
+#include <vector>
+
+static constexpr std::size_t games = 500'000;
+
+// The same balls through a FrameSet (heap frames, virtual calls) and an
+// InlineFrameSet (frames by value, calls resolved at compile time).
+BENCH(InlineFrames) {
+    // Ball masks knock down the first n pins, as in BenchScoreboard.
+    std::mt19937_64 seeds{38};
+    std::vector<uint16_t> balls;
+    for (std::size_t game = 0; game < games; ++game) {
+        InlineFrameSet frameSet{};
+        while (!frameSet.Ended()) {
+            const auto ball = static_cast<uint16_t>(0b11'11'11'11'11 & ~((1u << seeds() % 11) - 1));
+            frameSet.Bowled(PinSet{ball});
+            balls.push_back(ball);
+        }
+    }
+
+    const auto run = [&](const char* label, auto&& play) {
+        uint_fast64_t checksum = 0;
+        Bench::Measure(label, games, [&] { checksum = play(); });
+        std::cout << "  checksum " << checksum << "\n";
+    };
+
+    run("FrameSet, default resource, per game", [&] {
+        uint_fast64_t sum = 0;
+        auto ball = balls.begin();
+        for (std::size_t game = 0; game < games; ++game) {
+            FrameSet frameSet{};
+            while (!frameSet.Ended())
+                frameSet.Bowled(PinSet{*ball++});
+            sum += frameSet.Score();
+        }
+        return sum;
+    });
+    run("FrameSet, arena, per game", [&] {
+        GameArena arena{1};
+        uint_fast64_t sum = 0;
+        auto ball = balls.begin();
+        for (std::size_t game = 0; game < games; ++game) {
+            {
+                FrameSet frameSet{arena.Resource()};
+                while (!frameSet.Ended())
+                    frameSet.Bowled(PinSet{*ball++});
+                sum += frameSet.Score();
+            }
+            arena.Reset();
+        }
+        return sum;
+    });
+    run("InlineFrameSet, per game", [&] {
+        uint_fast64_t sum = 0;
+        auto ball = balls.begin();
+        for (std::size_t game = 0; game < games; ++game) {
+            InlineFrameSet frameSet{};
+            while (!frameSet.Ended())
+                frameSet.Bowled(PinSet{*ball++});
+            sum += frameSet.Score();
+        }
+        return sum;
+    });
+    std::cout << "  " << balls.size() << " balls, sizeof(InlineFrameSet) " << sizeof(InlineFrameSet) << " bytes\n";
+}
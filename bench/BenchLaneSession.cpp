@@ -0,0 +1,65 @@
+#include "Bench.h"
+
+#include "LaneSession.h"
+#include "PinSet.h"
+
+#include <memory_resource>
+#include <random>
+#include <vector>
+
+static constexpr std::size_t sessions = 10'000;
+
+class CountingListener : public ILaneListener {
+public:
+    uint64_t balls = 0;
+    uint64_t frames = 0;
+
+    void BallBowled(const BallEvent&) override {
+        ++balls;
+    }
+
+    void FrameEnded(const FrameEvent&) override {
+        ++frames;
+    }
+};
+
+// Lane pairs with six bowlers each, played a ball at a time in round robin as a
+// live feed would arrive, with and without a listener. A monotonic arena gives each
+// session exactly its games; a pool would round the 2.5 KB block up to 4 KB.
+static void Play(const char* label, ILaneListener* listener) {
+    CountingResource heap;
+    std::pmr::monotonic_buffer_resource arena{&heap};
+    std::vector<LaneSession> lanes;
+    lanes.reserve(sessions);
+    for (std::size_t i = 0; i < sessions; ++i)
+        lanes.emplace_back(LaneSession::maxBowlers, i % 2, listener, &arena);
+    std::cout << "  sizeof(LaneSession) " << sizeof(LaneSession) << " bytes, games "
+              << sizeof(InlineFrameSet) * LaneSession::maxBowlers << " bytes; " << heap.bytes
+              << " bytes in " << heap.allocations << " allocations for " << sessions << " sessions\n";
+
+    std::mt19937_64 rng{42};
+    std::vector<PinSet> balls;
+    for (auto i = 0; i < 1024; ++i)
+        balls.emplace_back(static_cast<uint_fast16_t>(rng()));
+
+    std::size_t live = sessions, ball = 0;
+    const auto seconds = Bench::Measure(label, sessions, [&] {
+        while (live) {
+            live = 0;
+            for (auto& lane : lanes) {
+                if (lane.Ended())
+                    continue;
+                ++live;
+                lane.Bowled(balls[ball++ & 1023]);
+            }
+        }
+    });
+    std::cout << "  " << ball << " balls, " << seconds * 1e9 / ball << " ns/ball\n";
+}
+
+BENCH(LaneSessions) {
+    Play("round robin without a listener, per session", nullptr);
+    CountingListener listener;
+    Play("round robin with a listener, per session", &listener);
+    std::cout << "  listener saw " << listener.balls << " balls, " << listener.frames << " frames\n";
+}
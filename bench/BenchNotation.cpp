@@ -0,0 +1,69 @@
+#include "Bench.h"
+
+#include "FrameSet.h"
+#include "Notation.h"
+#include "PinSet.h"
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static constexpr std::size_t games = 1'000'000;
+static constexpr std::size_t chunkSize = 1 << 20;
+
+// A notation file of random games, fed to a NotationStream 1 MiB at a time.
+BENCH(NotationParse) {
+    std::mt19937_64 seeds{39};
+    std::string text;
+    for (std::size_t game = 0; game < games; ++game) {
+        InlineFrameSet frameSet{};
+        PinSet rack;
+        while (!frameSet.Ended()) {
+            const auto frame = frameSet.CurrentFrame();
+            const auto ball = static_cast<uint16_t>(rack.Mask() & seeds());
+            frameSet.Bowled(PinSet{ball});
+            rack = PinSet{ball};
+            if (frameSet.CurrentFrame() != frame || ball == 0 || frameSet.FrameBalls(frame).count == 2)
+                rack = PinSet{};
+        }
+        text += Notation::Format(frameSet);
+        text += '\n';
+    }
+    const auto bytes = text.size();
+    std::cout << "  " << bytes / double(1 << 20) << " MiB, " << bytes / double(games) << " bytes per game\n";
+
+    std::vector<uint8_t> symbols(bytes);
+    const auto classify = Bench::Measure("classify, per byte", bytes, [&] {
+        Notation::Classify(text, symbols);
+    });
+    std::cout << "  " << bytes / classify / 1e9 << " GB/s\n";
+
+    uint_fast64_t parsed = 0, balls = 0;
+    const auto parse = Bench::Measure("stream parse, per game", games, [&] {
+        NotationStream stream;
+        const std::string_view all{text};
+        for (std::size_t i = 0; i < bytes; i += chunkSize)
+            for (const auto& game : stream.Feed(all.substr(i, chunkSize))) {
+                ++parsed;
+                balls += game.ballCount;
+            }
+        parsed += stream.Finish().size();
+    });
+    std::cout << "  " << bytes / parse / 1e9 << " GB/s, " << parsed << " games, " << balls << " balls\n";
+
+    std::string formatted;
+    const auto format = Bench::Measure("parse, bowl into an InlineFrameSet and format, per game", games, [&] {
+        NotationStream stream;
+        const std::string_view all{text};
+        for (std::size_t i = 0; i < bytes; i += chunkSize)
+            for (const auto& game : stream.Feed(all.substr(i, chunkSize))) {
+                InlineFrameSet frameSet{};
+                for (auto ball = 0; ball < game.ballCount; ++ball)
+                    frameSet.Bowled(PinSet{game.balls[ball]});
+                formatted += Notation::Format(frameSet);
+                formatted += '\n';
+            }
+    });
+    std::cout << "  " << bytes / format / 1e9 << " GB/s, round trip " << (formatted == text ? "matches" : "DIFFERS") << "\n";
+}
@@ -0,0 +1,58 @@
+#include "Bench.h"
+
+#include "PinSet.h"
+
+#include <random>
+#include <vector>
+
+static constexpr std::size_t racks = 1'000'000;
+static constexpr std::size_t rounds = 20;
+
+// The old operator&=: ten virtual IsDown calls and ten single-pin writes.
+static void AndPinByPin(IPinSet& rack, const IPinSet& ball) {
+    for (auto i = 0; i < 10; ++i)
+        if (ball.IsDown(static_cast<Pin>(i)))
+            rack.KnockDownPin(static_cast<Pin>(i));
+}
+
+BENCH(PinSetBulk) {
+    std::mt19937_64 rng{37};
+    std::vector<uint16_t> masks(racks), balls(racks);
+    std::vector<PinSet> rackSets(racks), ballSets(racks);
+    for (std::size_t i = 0; i < racks; ++i) {
+        balls[i] = static_cast<uint16_t>(rng() & 0x3FF);
+        for (auto pin = 0; pin < 10; ++pin)
+            if (!(balls[i] & (1u << pin)))
+                ballSets[i].KnockDownPin(static_cast<Pin>(pin));
+    }
+    std::vector<uint8_t> counts(racks);
+    uint_fast64_t checksum = 0;
+
+    Bench::Measure("pin by pin through IPinSet, per rack", racks * rounds, [&] {
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 0; i < racks; ++i) {
+                IPinSet& rack = rackSets[i];
+                rack.Reset();
+                AndPinByPin(rack, ballSets[i]);
+                checksum += rack.PinsUp();
+            }
+    });
+    Bench::Measure("PinSet::operator&= through IPinSet, per rack", racks * rounds, [&] {
+        for (std::size_t round = 0; round < rounds; ++round)
+            for (std::size_t i = 0; i < racks; ++i) {
+                IPinSet& rack = rackSets[i];
+                rack.Reset();
+                rack &= ballSets[i];
+                checksum += rack.PinsUp();
+            }
+    });
+    Bench::Measure("ResetAll + AndAll + PopcountAll, per rack", racks * rounds, [&] {
+        for (std::size_t round = 0; round < rounds; ++round) {
+            PinSet::ResetAll(masks);
+            PinSet::AndAll(masks, balls);
+            PinSet::PopcountAll(masks, counts);
+            checksum += counts[round];
+        }
+    });
+    std::cout << "  checksum " << checksum << "\n";
+}
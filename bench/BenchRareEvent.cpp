@@ -0,0 +1,27 @@
+#include "Bench.h"
+
+#include "RareEvent.h"
+
+#include <cmath>
+
+static void Report(const char* label, const RareEvent& event, const RareEvent::Options& options, double exact) {
+    RareEventEstimate estimate;
+    const auto seconds = Bench::Measure(label, 1, [&] { estimate = event.Estimate(options); });
+    std::cout << "  p = " << estimate.probability << " +- " << estimate.standardError << " [" << estimate.low << ", "
+              << estimate.high << "]";
+    if (exact > 0)
+        std::cout << ", exact " << exact;
+    std::cout << "\n  " << estimate.games << " games (" << estimate.games / seconds << "/s); plain Monte Carlo needs "
+              << estimate.naiveGames << " for this error, " << estimate.naiveGames / estimate.games << " times as many\n";
+}
+
+// Uniform balls, as main.cpp plays them.
+BENCH(RareEvents) {
+    const RareEvent event;
+    const auto perfect = std::pow(11.0, -12);
+    Report("perfect game, importance sampling", event, {RareEventMethod::IMPORTANCE_SAMPLING, 1, 300, 100'000}, perfect);
+    Report("perfect game, splitting", event, {RareEventMethod::SPLITTING, 1, 300, 10'000}, perfect);
+    Report("200 game, importance sampling", event, {RareEventMethod::IMPORTANCE_SAMPLING, 1, 200, 100'000, 47, 0.5}, 0);
+    Report("200 game, splitting", event, {RareEventMethod::SPLITTING, 1, 200, 10'000}, 0);
+    Report("800 series, splitting", event, {RareEventMethod::SPLITTING, 3, 800, 10'000}, 0);
+}
@@ -0,0 +1,114 @@
+#include "Bench.h"
+
+#include "FrameSet.h"
+#include "GameArena.h"
+#include "PinSet.h"
+#include "ReplayLog.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+static constexpr std::size_t games = 200'000;
+static constexpr std::size_t roundGames = 5'000;
+static constexpr auto rounds = 201;
+
+static volatile uint_fast64_t sink;
+
+// The production loop bowls every ball and refreshes the scoreboard; the recorder
+// adds 4 bytes per ball to that, written to /dev/null as a file would be.
+BENCH(ReplayLogOverhead) {
+    std::mt19937_64 seeds{43};
+    std::vector<uint16_t> balls;
+    std::size_t roundBalls = 0;
+    for (std::size_t game = 0; game < games; ++game) {
+        InlineFrameSet frameSet{};
+        while (!frameSet.Ended()) {
+            const auto ball = static_cast<uint16_t>(0b11'11'11'11'11 & ~((1u << seeds() % 11) - 1));
+            frameSet.Bowled(PinSet{ball});
+            balls.push_back(ball);
+        }
+        if (game + 1 == roundGames)
+            roundBalls = balls.size();
+    }
+
+    // Each round plays the same slice of games, so adjacent rounds see the same work.
+    const auto run = [&](auto&& startGame, auto&& bowl) {
+        GameArena arena{1};
+        uint_fast64_t checksum = 0;
+        const auto start = std::chrono::steady_clock::now();
+        auto ball = balls.begin();
+        for (std::size_t game = 0; game < roundGames; ++game) {
+            startGame();
+            {
+                FrameSet frameSet{arena.Resource()};
+                while (!frameSet.Ended())
+                    checksum += bowl(frameSet, PinSet{*ball++});
+            }
+            arena.Reset();
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        sink = checksum;
+        return elapsed.count();
+    };
+
+    std::ofstream out{"/dev/null", std::ios::binary};
+    ReplayRecorder recorder{out, 43};
+    const auto plainRun = [&] {
+        return run([] {}, [](FrameSet& frameSet, const PinSet& ball) {
+            frameSet.Bowled(ball);
+            return frameSet.FrameScores().back();
+        });
+    };
+    const auto recordedRun = [&] {
+        return run([&] { recorder.StartGame(); }, [&](FrameSet& frameSet, const PinSet& ball) {
+            return recorder.Bowled(frameSet, ball);
+        });
+    };
+    // This box's timings drift by far more than the overhead between runs a second
+    // apart, so the runs are short, paired and alternated, and the overhead is the
+    // median of the paired ratios.
+    std::vector<double> plain, recorded, ratios;
+    for (auto round = 0; round < rounds; ++round) {
+        if (round % 2) {
+            plain.push_back(plainRun());
+            recorded.push_back(recordedRun());
+        } else {
+            recorded.push_back(recordedRun());
+            plain.push_back(plainRun());
+        }
+        ratios.push_back(recorded.back() / plain.back());
+    }
+    const auto median = [](std::vector<double> values) {
+        std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+        return values[values.size() / 2];
+    };
+    std::cout << "  bowl and scoreboard, per ball: " << median(plain) * 1e9 / roundBalls << " ns\n"
+              << "  bowl and scoreboard with a replay log, per ball: " << median(recorded) * 1e9 / roundBalls << " ns\n"
+              << "  overhead " << (median(ratios) - 1) * 100 << "% (median of " << rounds << " paired rounds of "
+              << roundGames << " games), log "
+              << (sizeof(ReplayHeader) + balls.size() * sizeof(ReplayEntry)) / double(1 << 20) << " MiB\n";
+
+    std::istringstream in;
+    {
+        std::ostringstream out;
+        {
+            ReplayRecorder recorder{out, 43};
+            auto ball = balls.begin();
+            for (std::size_t game = 0; game < games; ++game) {
+                recorder.StartGame();
+                InlineFrameSet frameSet{};
+                while (!frameSet.Ended())
+                    recorder.Bowled(frameSet, PinSet{*ball++});
+            }
+        }
+        in.str(out.str());
+    }
+    ReplayResult result;
+    Bench::Measure("replay and verify, per ball", balls.size(), [&] { result = ReplayLog::Replay(in); });
+    std::cout << "  " << result.games << " games, " << result.balls << " balls, "
+              << (result.diverged ? "DIVERGED" : "all match") << "\n";
+}
@@ -0,0 +1,55 @@
+#include "Bench.h"
+
+#include "Archive.h"
+#include "RescorePipeline.h"
+
+#include <filesystem>
+#include <random>
+#include <thread>
+#include <vector>
+
+static constexpr std::size_t games = 2'000'000;
+
+// Rescores a 128 MB archive with each engine; the output goes to
+// the same temporary directory, so the figure includes writing it back.
+BENCH(RescoreArchive) {
+    const auto directory = std::filesystem::temp_directory_path();
+    const auto inputPath = (directory / "BenchRescoreInput.bwl").string();
+    const auto outputPath = (directory / "BenchRescoreOutput.bwl").string();
+    {
+        std::mt19937_64 rng{36};
+        ArchiveWriter writer{inputPath};
+        std::vector<ArchiveRecord> records(4096);
+        for (std::size_t written = 0; written < games; written += records.size()) {
+            for (auto& record : records) {
+                // Perfect games and gutter games, a tenth of them stored with the wrong score.
+                const auto perfect = rng() % 2;
+                record.gameId = written;
+                record.ballCount = perfect ? 12 : 20;
+                record.balls.fill(perfect ? 0 : 0x3FF);
+                record.storedScore = perfect ? 300 : 0;
+                if (rng() % 10 == 0)
+                    ++record.storedScore;
+            }
+            writer.Write(records);
+        }
+    }
+
+    const auto cores = std::max(1u, std::thread::hardware_concurrency());
+    for (const auto engine : {RescoreEngine::FRAMESET, RescoreEngine::BATCH}) {
+        RescorePipeline::Options options;
+        options.engine = engine;
+        options.scoreThreads = cores;
+        RescoreProgress result;
+        Bench::Measure(engine == RescoreEngine::FRAMESET ? "FrameSet pipeline, per game" : "GameBatch pipeline, per game",
+                       games, [&] {
+            const ArchiveReader input{inputPath};
+            ArchiveWriter output{outputPath};
+            result = RescorePipeline{options}.Run(input, output);
+        });
+        std::cout << "  " << result.RecordsPerSecond() << " games/s, " << result.BytesPerSecond() / 1e6
+                  << " MB/s, " << result.changed << " changed, " << result.invalid << " invalid\n";
+    }
+    std::filesystem::remove(inputPath);
+    std::filesystem::remove(outputPath);
+}
@@ -0,0 +1,189 @@
+#include "Bench.h"
+
+#include "GameArena.h"
+#include "Simulation.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+static constexpr uint_fast64_t games = 400'000;
+static constexpr std::size_t triadDoubles = 8 << 20;
+
+namespace {
+    struct Cpu {
+        int id = 0;
+        int node = 0;
+    };
+
+    // "0-3,8-11" as a list of CPU ids.
+    std::vector<int> ParseCpuList(const std::string& list) {
+        std::vector<int> cpus;
+        std::istringstream in{list};
+        std::string range;
+        while (std::getline(in, range, ',')) {
+            const auto dash = range.find('-');
+            const auto first = std::stoi(range.substr(0, dash));
+            const auto last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (auto cpu = first; cpu <= last; ++cpu)
+                cpus.push_back(cpu);
+        }
+        return cpus;
+    }
+
+    // CPUs node by node, so thread t on Cpus()[t] fills one socket before spilling
+    // onto the next. Without NUMA information every CPU is on node 0.
+    const std::vector<Cpu>& Cpus() {
+        static const auto cpus = [] {
+            std::vector<Cpu> result;
+            for (auto node = 0;; ++node) {
+                std::ifstream in{"/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"};
+                std::string list;
+                if (!std::getline(in, list))
+                    break;
+                if (!list.empty())
+                    for (auto cpu : ParseCpuList(list))
+                        result.push_back({cpu, node});
+            }
+            if (result.empty())
+                for (auto cpu = 0u; cpu < std::max(1u, std::thread::hardware_concurrency()); ++cpu)
+                    result.push_back({static_cast<int>(cpu), 0});
+            return result;
+        }();
+        return cpus;
+    }
+
+    // Runs fn(t) on threads pinned one per CPU. Whatever fn allocates and touches
+    // first lands on its thread's node.
+    template <typename F>
+    double RunPinned(unsigned threads, F&& fn) {
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> workers;
+        for (unsigned t = 0; t < threads; ++t)
+            workers.emplace_back([&fn, t] {
+#ifdef __linux__
+                cpu_set_t set;
+                CPU_ZERO(&set);
+                CPU_SET(Cpus()[t % Cpus().size()].id, &set);
+                pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+                fn(t);
+            });
+        for (auto& i : workers)
+            i.join();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    std::vector<unsigned> ThreadCounts() {
+        const auto most = std::max<unsigned>(2, Cpus().size());
+        std::vector<unsigned> counts;
+        for (unsigned threads = 1; threads < most; threads *= 2)
+            counts.push_back(threads);
+        counts.push_back(most);
+        return counts;
+    }
+
+    unsigned Nodes(unsigned threads) {
+        int last = -1;
+        unsigned nodes = 0;
+        for (unsigned t = 0; t < std::min<std::size_t>(threads, Cpus().size()); ++t)
+            if (Cpus()[t].node != last) {
+                last = Cpus()[t].node;
+                ++nodes;
+            }
+        return nodes;
+    }
+
+    // Stream triad a = b + s * c over arrays split between the threads, each
+    // thread's part first touched by that thread. Bytes moved per second.
+    double TriadBandwidth(unsigned threads) {
+        const auto share = triadDoubles / threads;
+        std::vector<std::vector<double>> a(threads), b(threads), c(threads);
+        RunPinned(threads, [&](unsigned t) {
+            a[t].assign(share, 0);
+            b[t].assign(share, 1);
+            c[t].assign(share, 2);
+        });
+        constexpr auto repeats = 5;
+        const auto seconds = RunPinned(threads, [&](unsigned t) {
+            for (auto repeat = 0; repeat < repeats; ++repeat)
+                for (std::size_t i = 0; i < share; ++i)
+                    a[t][i] = b[t][i] + 3 * c[t][i];
+        });
+        return repeats * 3.0 * sizeof(double) * share * threads / seconds;
+    }
+
+    struct Packed {
+        uint64_t games = 0;
+        uint64_t total = 0;
+    };
+
+    struct alignas(64) Padded {
+        uint64_t games = 0;
+        uint64_t total = 0;
+    };
+
+    // Every thread stores its running totals to its own slot after each game, as a
+    // progress counter another thread could read.
+    template <typename Slot>
+    double Counters(unsigned threads) {
+        std::vector<Slot> slots(threads);
+        const Simulation simulation;
+        const auto seconds = RunPinned(threads, [&](unsigned t) {
+            std::mt19937_64 rng{45 + t};
+            auto& slot = slots[t];
+            simulation.Play(SimulationEngine::INLINE, games / threads, rng, [&](uint_fast16_t score) {
+                std::atomic_ref{slot.games}.store(slot.games + 1, std::memory_order_relaxed);
+                std::atomic_ref{slot.total}.store(slot.total + score, std::memory_order_relaxed);
+            });
+        });
+        return games / threads * threads / seconds;
+    }
+}
+
+// main.cpp's game loop on each engine at 1 to N pinned threads, splitting a fixed
+// number of games between them. Threads fill one NUMA node before the next.
+BENCH(ParallelScaling) {
+    std::cout << "  " << Cpus().size() << " CPUs on " << Nodes(Cpus().size()) << " NUMA nodes\n";
+    const Simulation simulation;
+    for (const auto engine : {SimulationEngine::HEAP, SimulationEngine::ARENA, SimulationEngine::INLINE}) {
+        std::cout << "  " << Simulation::Name(engine) << "\n"
+                  << "    threads nodes games/s speedup efficiency allocated-GB/s\n";
+        const auto heap = engine == SimulationEngine::HEAP || engine == SimulationEngine::ARENA;
+        const auto bytesPerGame = heap ? GameArena::BytesPerGame() : 0;
+        double single = 0;
+        for (const auto threads : ThreadCounts()) {
+            std::vector<SimulationTotals> totals(threads);
+            const auto seconds = RunPinned(threads, [&](unsigned t) {
+                std::mt19937_64 rng{45 + t};
+                totals[t] = simulation.Play(engine, games / threads, rng);
+            });
+            const auto rate = games / threads * threads / seconds;
+            if (threads == 1)
+                single = rate;
+            std::cout << "    " << threads << ' ' << Nodes(threads) << ' ' << rate << ' ' << rate / single << ' '
+                      << rate / single / threads << ' ' << rate * bytesPerGame / 1e9 << '\n';
+        }
+    }
+
+    std::cout << "  stream triad\n    threads GB/s\n";
+    for (const auto threads : ThreadCounts())
+        std::cout << "    " << threads << ' ' << TriadBandwidth(threads) / 1e9 << '\n';
+
+    const auto threads = ThreadCounts().back();
+    std::cout << "  per-game counters on " << threads << " threads, InlineFrameSet\n"
+              << "    packed next to each other: " << Counters<Packed>(threads) << " games/s\n"
+              << "    one cache line each: " << Counters<Padded>(threads) << " games/s\n";
+}
@@ -0,0 +1,72 @@
+#include "Bench.h"
+
+#include "FrameSet.h"
+#include "ScoreHistogram.h"
+#include "Simulation.h"
+
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+static constexpr std::size_t games = 100'000;
+static constexpr std::size_t rounds = 50;
+
+template <typename F>
+static void RunThreads(unsigned threads, F&& fn) {
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t)
+        workers.emplace_back(fn, t);
+    for (auto& i : workers)
+        i.join();
+}
+
+// Every thread adds the same games' scores, once to its own shard of a
+// ScoreCollector and once to one histogram of atomic counters they all share.
+BENCH(ScoreHistogramShards) {
+    std::mt19937_64 rng{44};
+    std::vector<InlineFrameSet> played(games);
+    std::vector<uint16_t> scores(games);
+    for (std::size_t game = 0; game < games; ++game) {
+        auto& frameSet = played[game];
+        Simulation::PlayRacks(frameSet, [&](uint16_t standing) { return static_cast<uint16_t>(standing & rng()); });
+        scores[game] = static_cast<uint16_t>(frameSet.Score());
+    }
+
+    const auto threads = std::max(4u, std::thread::hardware_concurrency());
+    const auto added = games * rounds * threads;
+    std::cout << "  " << threads << " threads on " << std::thread::hardware_concurrency() << " cores\n";
+
+    ScoreCollector collector{threads};
+    Bench::Measure("sharded, per score", added, [&] {
+        RunThreads(threads, [&](unsigned t) {
+            auto& shard = collector.Shard(t);
+            for (std::size_t round = 0; round < rounds; ++round)
+                for (auto score : scores)
+                    shard.Add(score);
+        });
+    });
+
+    std::vector<std::atomic<uint64_t>> shared(Histogram::bins);
+    Bench::Measure("one shared atomic histogram, per score", added, [&] {
+        RunThreads(threads, [&](unsigned) {
+            for (std::size_t round = 0; round < rounds; ++round)
+                for (auto score : scores)
+                    shared[score].fetch_add(1, std::memory_order_relaxed);
+        });
+    });
+
+    ScoreCollector detailed{threads, {true, 16}};
+    Bench::Measure("sharded with frames and 16 bowlers, per game", games * threads, [&] {
+        RunThreads(threads, [&](unsigned t) {
+            auto& shard = detailed.Shard(t);
+            for (std::size_t game = 0; game < games; ++game)
+                shard.Add(played[game], game % 16);
+        });
+    });
+
+    ScoreHistogram merged;
+    Bench::Measure("merge, per shard", threads, [&] { merged = collector.Merge(); });
+    std::cout << "  " << merged.Games().Total() << " games, mean " << merged.Games().Mean() << ", median "
+              << merged.Games().Percentile(0.5) << ", 99th percentile " << merged.Games().Percentile(0.99) << '\n';
+}
@@ -0,0 +1,63 @@
+#include "Bench.h"
+
+#include "FrameSet.h"
+#include "PinSet.h"
+
+#include <array>
+#include <random>
+#include <vector>
+
+static constexpr std::size_t games = 200'000;
+
+// A scoreboard refresh after every ball: without per-frame totals a display
+// rescores the game once per frame; the cache should cost no more than one Score().
+BENCH(ScoreboardRefresh) {
+    std::array<PinSet, 11> balls;
+    for (auto i = 0; i < 11; ++i)
+        for (auto pin = 0; pin < i; ++pin)
+            balls[i].KnockDownPin(static_cast<Pin>(pin));
+
+    std::mt19937_64 seeds{11};
+    std::vector<uint_fast8_t> sequence;
+    for (std::size_t game = 0; game < games; ++game) {
+        FrameSet frameSet{};
+        while (!frameSet.Ended()) {
+            const auto pins = static_cast<uint_fast8_t>(seeds() % 11);
+            frameSet.Bowled(balls[pins]);
+            sequence.push_back(pins);
+        }
+    }
+
+    const auto run = [&](const char* label, auto&& refresh) {
+        uint_fast64_t checksum = 0;
+        const auto seconds = Bench::Measure(label, sequence.size(), [&] {
+            auto ball = sequence.begin();
+            for (std::size_t game = 0; game < games; ++game) {
+                FrameSet frameSet{};
+                while (!frameSet.Ended()) {
+                    frameSet.Bowled(balls[*ball++]);
+                    checksum += refresh(frameSet);
+                }
+            }
+        });
+        std::cout << "  checksum " << checksum << "\n";
+        return seconds;
+    };
+
+    run("bowl only, per ball", [](const FrameSet&) { return uint_fast64_t{0}; });
+    run("full scoreboard by rescoring once per frame, per ball", [](const FrameSet& frameSet) {
+        uint_fast64_t sum = 0;
+        for (auto i = 0; i < 10; ++i)
+            sum += frameSet.Score();
+        return sum;
+    });
+    run("single Score(), per ball", [](const FrameSet& frameSet) {
+        return static_cast<uint_fast64_t>(frameSet.Score());
+    });
+    run("full scoreboard via FrameScores(), per ball", [](const FrameSet& frameSet) {
+        uint_fast64_t sum = 0;
+        for (auto i : frameSet.FrameScores())
+            sum += i;
+        return sum;
+    });
+}
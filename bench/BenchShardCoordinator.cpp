@@ -0,0 +1,47 @@
+#include "Bench.h"
+
+#include "ShardCoordinator.h"
+#include "Simulation.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+static constexpr uint64_t games = 2'000'000;
+
+// Games on forked workers against the same games on threads, then what smaller
+// chunks, and so more checkpoints, cost.
+BENCH(ShardedProcesses) {
+    const Simulation simulation;
+    const auto workers = std::max(2u, std::thread::hardware_concurrency());
+    std::cout << "  " << workers << " workers on " << std::thread::hardware_concurrency() << " cores\n";
+
+    ShardCoordinator::Options options;
+    options.workers = workers;
+    options.games = games;
+    const auto run = [&] {
+        const ShardCoordinator coordinator{simulation, options};
+        coordinator.Run();
+    };
+    Bench::Measure("processes, per game", games, run);
+
+    Bench::Measure("threads, per game", games, [&] {
+        std::vector<std::thread> threads;
+        std::vector<SimulationTotals> totals(workers);
+        for (unsigned t = 0; t < workers; ++t)
+            threads.emplace_back([&, t] {
+                auto rng = ShardCoordinator::ChunkRng(options.seed, t);
+                totals[t] = simulation.Play(options.engine, games / workers, rng);
+            });
+        for (auto& i : threads)
+            i.join();
+    });
+
+    for (const uint64_t chunkGames : {100'000, 10'000, 1'000, 100}) {
+        options.chunkGames = chunkGames;
+        const auto label = "processes, " + std::to_string(chunkGames) + " games per checkpoint, per game";
+        Bench::Measure(label.c_str(), games, run);
+    }
+}
@@ -0,0 +1,48 @@
+#include "Bench.h"
+
+#include "Archive.h"
+#include "FrameSet.h"
+#include "Simulation.h"
+#include "SkillModel.h"
+
+#include <random>
+#include <thread>
+#include <vector>
+
+static constexpr std::size_t games = 2'000'000;
+
+// Fits a model from an in-memory archive of random games from 10000 bowlers,
+// then samples games from it.
+BENCH(SkillModelFit) {
+    std::mt19937_64 seeds{40};
+    std::vector<ArchiveRecord> records(games);
+    for (std::size_t game = 0; game < games; ++game) {
+        auto& record = records[game];
+        record.bowlerId = static_cast<uint32_t>(game / 20 % 10'000);
+        InlineFrameSet frameSet{};
+        Simulation::PlayRacks(frameSet, [&](uint16_t standing) {
+            const auto after = static_cast<uint16_t>(standing & seeds());
+            record.balls[record.ballCount++] = after;
+            return after;
+        });
+    }
+
+    const auto threads = std::max(1u, std::thread::hardware_concurrency());
+    SkillModel model;
+    const auto seconds = Bench::Measure("fit, per game", games, [&] { model = SkillModel::Fit(records, threads); });
+    std::cout << "  " << threads << " threads, " << games / seconds << " games/s, 100M games in "
+              << 1e8 / (games / seconds) << " s, " << model.Bowlers().size() << " bowlers\n";
+
+    std::mt19937_64 rng{41};
+    uint64_t total = 0;
+    constexpr std::size_t played = 200'000;
+    Bench::Measure("sample and score, per game", played, [&] {
+        for (std::size_t game = 0; game < played; ++game) {
+            const auto& bowler = model.Find(static_cast<uint32_t>(game % 10'000));
+            InlineFrameSet frameSet{};
+            Simulation::PlayRacks(frameSet, [&](uint16_t standing) { return model.Sample(bowler, standing, rng); });
+            total += frameSet.Score();
+        }
+    });
+    std::cout << "  average " << static_cast<double>(total) / played << "\n";
+}
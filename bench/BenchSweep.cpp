@@ -0,0 +1,26 @@
+#include "Bench.h"
+
+#include "Sweep.h"
+
+#include <thread>
+
+// A 7 x 7 x 2 grid worked out exactly on one thread and on every core, then once
+// more from the cache; and what simulating a point costs by comparison.
+BENCH(ParameterSweep) {
+    const Sweep sweep;
+    const SweepGrid grid{{-0.03, -0.02, -0.01, 0, 0.01, 0.02, 0.03}, {-0.03, -0.02, -0.01, 0, 0.01, 0.02, 0.03},
+                         {true, false}};
+    const auto points = grid.Points().size();
+    Sweep::Options options;
+    options.threads = 1;
+    Bench::Measure("exact, one thread, per point", points, [&] { sweep.Run(grid, options); });
+    options.threads = std::thread::hardware_concurrency();
+    SweepCache cache;
+    Bench::Measure("exact, every core, per point", points, [&] { sweep.Run(grid, options, &cache); });
+    Bench::Measure("from the cache, per point", points, [&] { sweep.Run(grid, options, &cache); });
+
+    options.method = SweepMethod::SIMULATION;
+    options.games = 100'000;
+    const SweepGrid one;
+    Bench::Measure("simulated, 100000 games, per game", options.games, [&] { sweep.Run(one, options); });
+}
@@ -0,0 +1,62 @@
+#include "Bench.h"
+
+#include "Archive.h"
+#include "FrameSet.h"
+#include "Simulation.h"
+#include "SkillModel.h"
+#include "WinProbability.h"
+
+#include <bit>
+#include <random>
+#include <vector>
+
+// Live odds for a televised final: the engine is built once per match, then
+// updated and queried after every ball.
+BENCH(WinProbabilityLive) {
+    std::mt19937_64 seeds{41};
+    std::vector<ArchiveRecord> records(100'000);
+    for (std::size_t game = 0; game < records.size(); ++game) {
+        auto& record = records[game];
+        record.bowlerId = static_cast<uint32_t>(game % 2);
+        InlineFrameSet frameSet{};
+        Simulation::PlayRacks(frameSet, [&](uint16_t standing) {
+            const auto after = static_cast<uint16_t>(standing & (seeds() | seeds()));
+            record.balls[record.ballCount++] = after;
+            return after;
+        });
+    }
+    const auto model = SkillModel::Fit(records);
+
+    constexpr std::size_t matches = 200;
+    Bench::Measure("build the engine for a match", matches, [&] {
+        for (std::size_t i = 0; i < matches; ++i)
+            WinProbability{model, model.Find(0), model.Find(1)};
+    });
+
+    WinProbability engine{model, model.Find(0), model.Find(1)};
+    std::mt19937_64 rng{42};
+    std::vector<std::pair<std::size_t, uint_fast8_t>> balls;
+    for (std::size_t match = 0; match < matches; ++match)
+        for (std::size_t player = 0; player < 2; ++player) {
+            InlineFrameSet frameSet{};
+            Simulation::PlayRacks(frameSet, [&](uint16_t standing) {
+                const auto after = model.Sample(model.Find(player), standing, rng);
+                balls.emplace_back(player, std::popcount(standing) - std::popcount(after));
+                return after;
+            });
+            balls.emplace_back(player, 0xFF);
+        }
+    double checksum = 0;
+    Bench::Measure("Bowled and Current, per ball", balls.size(), [&] {
+        for (const auto& [player, pins] : balls) {
+            if (pins == 0xFF) {
+                if (player == 1)
+                    engine.Reset();
+                continue;
+            }
+            engine.Bowled(player, pins);
+            checksum += engine.Current().first;
+        }
+    });
+    std::cout << "  checksum " << checksum << "\n";
+}
@@ -0,0 +1,17 @@
+#!/bin/sh
+# Builds the release, release-lto and PGO presets and runs the same bench on each.
+set -e
+cd "$(dirname "$0")/.."
+
+for preset in release release-lto; do
+    cmake --preset "$preset" > /dev/null
+    cmake --build --preset "$preset" --target BenchBowlingSimulator
+    "build/$preset/BenchBowlingSimulator" Configurations
+done
+
+rm -rf build/pgo/pgo-profile
+cmake --preset pgo-generate > /dev/null
+cmake --build --preset pgo-generate --target PgoTraining
+cmake --preset pgo-use > /dev/null
+cmake --build --preset pgo-use --target BenchBowlingSimulator
+build/pgo/BenchBowlingSimulator Configurations
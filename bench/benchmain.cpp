@@ -0,0 +1,46 @@
+#include "Bench.h"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+static std::vector<std::pair<const char*, Bench::Fn>>& Registry() {
+    static std::vector<std::pair<const char*, Bench::Fn>> benches;
+    return benches;
+}
+
+int Bench::Register(const char* name, Fn fn) {
+    Registry().emplace_back(name, fn);
+    return static_cast<int>(Registry().size());
+}
+
+int Bench::RunAll(const char* filter) {
+    for (const auto& [name, fn] : Registry()) {
+        if (filter && !std::strstr(name, filter))
+            continue;
+        std::cout << name << "\n";
+        fn();
+    }
+    return 0;
+}
+
+CountingResource::CountingResource(std::pmr::memory_resource* upstream) : upstream{upstream} {
+}
+
+void* CountingResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    ++allocations;
+    this->bytes += bytes;
+    return upstream->allocate(bytes, alignment);
+}
+
+void CountingResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+    upstream->deallocate(p, bytes, alignment);
+}
+
+bool CountingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+int main(int argc, char** argv) {
+    return Bench::RunAll(argc > 1 ? argv[1] : nullptr);
+}
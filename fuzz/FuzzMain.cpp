@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, std::size_t size);
+
+// Stands in for libFuzzer where it is not available (GCC builds):
+//   FuzzBowlingSimulator [-games N] [-threads T] [-seed S]   random inputs
+//   FuzzBowlingSimulator file...                              replay saved inputs
+// Random balls are biased toward strikes, spares and the pins already down so
+// bonus and tenth-frame paths come up often.
+static void Run(uint_fast64_t games, uint_fast64_t seed) {
+    std::mt19937_64 rng{seed};
+    std::vector<uint8_t> input;
+    for (uint_fast64_t game = 0; game < games; ++game) {
+        input.resize(2 * (rng() % 26));
+        for (std::size_t i = 0; i < input.size(); i += 2) {
+            const auto bits = rng();
+            uint16_t mask;
+            switch (bits & 3) {
+                case 0:
+                    mask = 0;
+                    break;
+                case 1:
+                    mask = static_cast<uint16_t>(bits >> 8);
+                    break;
+                default:
+                    mask = static_cast<uint16_t>((bits >> 8) & (bits >> 24));
+                    break;
+            }
+            input[i] = static_cast<uint8_t>(mask);
+            input[i + 1] = static_cast<uint8_t>(mask >> 8);
+        }
+        LLVMFuzzerTestOneInput(input.data(), input.size());
+    }
+}
+
+int main(int argc, char** argv) {
+    uint_fast64_t games = 1'000'000;
+    uint_fast64_t seed = std::random_device{}();
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::string> files;
+    for (auto i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "-games" && i + 1 < argc)
+            games = std::stoull(argv[++i]);
+        else if (arg == "-seed" && i + 1 < argc)
+            seed = std::stoull(argv[++i]);
+        else if (arg == "-threads" && i + 1 < argc)
+            threads = std::max(1, std::stoi(argv[++i]));
+        else
+            files.push_back(arg);
+    }
+
+    if (!files.empty()) {
+        for (const auto& i : files) {
+            std::ifstream in{i, std::ios::binary};
+            const std::vector<uint8_t> input{std::istreambuf_iterator<char>{in}, {}};
+            LLVMFuzzerTestOneInput(input.data(), input.size());
+        }
+        std::cout << "Replayed " << files.size() << " inputs\n";
+        return 0;
+    }
+
+    std::cout << "Seed " << seed << ", " << threads << " threads\n";
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < threads; ++i)
+        workers.emplace_back(Run, games / threads + (i < games % threads), seed + i);
+    for (auto& i : workers)
+        i.join();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << games << " games in " << elapsed.count() << " s, " << games / elapsed.count() << " games/s\n";
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include "ReferenceScorer.h"
+
+#include "FrameSet.h"
+#include "GameArena.h"
+#include "GameBatch.h"
+#include "GameStateTable.h"
+#include "PinSet.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+static PinSet FromMask(uint16_t mask) {
+    PinSet pins;
+    for (auto i = 0; i < 10; ++i)
+        if (!(mask & (1u << i)))
+            pins.KnockDownPin(static_cast<Pin>(i));
+    return pins;
+}
+
+[[noreturn]] static void Mismatch(const char* what, const uint8_t* data, std::size_t ball, int expected, int actual) {
+    std::fprintf(stderr, "Mismatch in %s after ball %zu: expected %d, got %d\nBalls:", what, ball + 1, expected, actual);
+    for (std::size_t i = 0; i <= ball; ++i)
+        std::fprintf(stderr, " %03x", (data[2 * i] | data[2 * i + 1] << 8) & 0x3FF);
+    std::fprintf(stderr, "\n");
+    std::abort();
+}
+
+// Every two bytes of input are one ball: the low ten bits are the pins the ball
+// leaves standing, in the PinSet layout. After every ball FrameSet (on real frames),
+// its frame score cache, GameBatch and the state table must all agree with the
+// reference, and so must the end of the game.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, std::size_t size) {
+    thread_local GameArena arena{1};
+    thread_local GameBatch batch{1};
+    batch.Reset();
+    {
+        FrameSet frameSet{arena.Resource()};
+        ReferenceScorer reference;
+        auto state = GameStateTable::start;
+        uint_fast16_t tableScore = 0;
+        uint16_t batchScore = 0;
+
+        for (std::size_t ball = 0; 2 * ball + 1 < size && !reference.Ended(); ++ball) {
+            const auto mask = static_cast<uint16_t>((data[2 * ball] | data[2 * ball + 1] << 8) & 0x3FF);
+            if (frameSet.Ended())
+                Mismatch("end of game", data, ball, 0, 1);
+            if (reference.Standing() != GameStateTable::standing[state])
+                Mismatch("state table pins standing", data, ball, reference.Standing(), GameStateTable::standing[state]);
+
+            frameSet.Bowled(FromMask(mask));
+            const auto down = reference.Bowl(mask);
+            batch.BowlAll({&mask, 1});
+            batch.ScoreAll({&batchScore, 1});
+            tableScore += GameStateTable::points[state][down];
+            state = GameStateTable::next[state][down];
+
+            const uint_fast16_t expected = reference.Score();
+            if (frameSet.Score() != expected)
+                Mismatch("FrameSet::Score", data, ball, expected, frameSet.Score());
+            if (frameSet.FrameScores().back() != expected)
+                Mismatch("FrameSet::FrameScores", data, ball, expected, frameSet.FrameScores().back());
+            if (batchScore != expected)
+                Mismatch("GameBatch", data, ball, expected, batchScore);
+            if (tableScore != expected)
+                Mismatch("GameStateTable", data, ball, expected, tableScore);
+            if (frameSet.Ended() != reference.Ended() || batch.Ended(0) != reference.Ended() ||
+                (state == GameStateTable::end) != reference.Ended())
+                Mismatch("end of game", data, ball, reference.Ended(), frameSet.Ended());
+        }
+    }
+    arena.Reset();
+    return 0;
+}
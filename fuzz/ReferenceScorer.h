@@ -0,0 +1,100 @@
+#ifndef BOWLINGSIMULATOR_REFERENCESCORER_H
+#define BOWLINGSIMULATOR_REFERENCESCORER_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+// The textbook scorer, kept as plain as possible so it can be trusted: the rack
+// is tracked as a mask, every ball becomes a pin count, and Score walks the
+// counts frame by frame. Balls not bowled yet count as zero.
+class ReferenceScorer {
+    std::array<int, 21> rolls{};
+    std::size_t rollCount = 0;
+    uint16_t standing = 0x3FF;
+    int frame = 0;
+    int ball = 0;
+
+    static int PinsUp(uint16_t mask) {
+        return std::popcount(mask);
+    }
+
+    int Roll(std::size_t i) const {
+        return i < rollCount ? rolls[i] : 0;
+    }
+
+public:
+    bool Ended() const {
+        return frame == 10;
+    }
+
+    int Standing() const {
+        return PinsUp(standing);
+    }
+
+    uint16_t StandingMask() const {
+        return standing;
+    }
+
+    std::size_t Balls() const {
+        return rollCount;
+    }
+
+    // Returns the number of pins the ball knocked down.
+    int Bowl(uint16_t ballMask) {
+        const int before = PinsUp(standing);
+        standing &= ballMask;
+        const int down = before - PinsUp(standing);
+        rolls[rollCount++] = down;
+
+        if (frame < 9) {
+            if (ball == 0 && standing == 0) {
+                ++frame;
+                standing = 0x3FF;
+            } else if (ball == 1) {
+                ++frame;
+                ball = 0;
+                standing = 0x3FF;
+            } else {
+                ball = 1;
+            }
+            return down;
+        }
+
+        const int first = rolls[rollCount - 1 - ball];
+        if (ball == 0) {
+            ball = 1;
+        } else if (ball == 1) {
+            if (first == 10 || standing == 0)
+                ball = 2;
+            else
+                frame = 10;
+        } else {
+            frame = 10;
+        }
+        if (standing == 0)
+            standing = 0x3FF;
+        return down;
+    }
+
+    int Score() const {
+        int total = 0;
+        std::size_t i = 0;
+        for (int f = 0; f < 10 && i < rollCount; ++f) {
+            if (Roll(i) == 10) {
+                total += 10 + Roll(i + 1) + Roll(i + 2);
+                i += 1;
+            } else if (Roll(i) + Roll(i + 1) == 10) {
+                total += 10 + Roll(i + 2);
+                i += 2;
+            } else {
+                total += Roll(i) + Roll(i + 1);
+                i += 2;
+            }
+        }
+        return total;
+    }
+};
+
+#endif //BOWLINGSIMULATOR_REFERENCESCORER_H
@@ -0,0 +1,19 @@
+#ifndef BOWLINGSIMULATOR_ACCURACYMODEL_H
+#define BOWLINGSIMULATOR_ACCURACYMODEL_H
+
+#include "interface/IAccuracyModel.h"
+
+// The ball hits the targeted pin with the given accuracy, otherwise it drifts
+// evenly onto the pin to the left or right in the same row. Whatever pin is hit
+// falls together with every standing pin behind it.
+class AccuracyModel : public IAccuracyModel {
+    double accuracy;
+
+    static uint_fast16_t Cascade(uint_fast16_t standing, int pin);
+
+public:
+    AccuracyModel(double accuracy);
+
+    Outcomes_t Outcomes(uint_fast16_t standing, Pin target) const override;
+};
+#endif //BOWLINGSIMULATOR_ACCURACYMODEL_H
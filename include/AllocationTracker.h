@@ -0,0 +1,75 @@
+#ifndef BOWLINGSIMULATOR_ALLOCATIONTRACKER_H
+#define BOWLINGSIMULATOR_ALLOCATIONTRACKER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// What a global allocation is charged to: whatever AllocationTracker::Scope is
+// innermost on the allocating thread.
+enum class Subsystem : uint8_t {
+    OTHER,
+    FRAMES,
+    PIN_SETS,
+    ARENA,
+    SESSIONS
+};
+
+struct AllocationStats {
+    static constexpr std::size_t subsystems = 5;
+
+    std::array<uint64_t, subsystems> allocations{};
+    std::array<uint64_t, subsystems> bytes{};
+    uint64_t frees = 0;
+
+    uint64_t Allocations() const;
+
+    uint64_t Bytes() const;
+
+    uint64_t Allocations(Subsystem subsystem) const;
+
+    uint64_t Bytes(Subsystem subsystem) const;
+
+    // What happened between an earlier snapshot and this one.
+    AllocationStats operator-(const AllocationStats& earlier) const;
+};
+
+// Counts global operator new and delete calls per thread, without locks. Nothing is
+// counted unless the program links the replacement operators in
+// src/AllocationHook.cpp (the BowlingSimulatorAllocationHook target).
+class AllocationTracker {
+    static inline thread_local Subsystem current = Subsystem::OTHER;
+
+public:
+    class Scope {
+        Subsystem previous;
+
+    public:
+        explicit Scope(Subsystem subsystem) : previous{current} {
+            current = subsystem;
+        }
+
+        ~Scope() {
+            current = previous;
+        }
+
+        Scope(const Scope&) = delete;
+
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    static bool Installed();
+
+    static const char* Name(Subsystem subsystem);
+
+    // Everything the calling thread has allocated so far.
+    static AllocationStats ThisThread();
+
+    // Called by the replacement operators.
+    static void Install();
+
+    static void Allocated(std::size_t bytes);
+
+    static void Freed();
+};
+#endif //BOWLINGSIMULATOR_ALLOCATIONTRACKER_H
@@ -0,0 +1,82 @@
+#ifndef BOWLINGSIMULATOR_ARCHIVE_H
+#define BOWLINGSIMULATOR_ARCHIVE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+class ArchiveException : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// On-disk game archive: a header followed by fixed 64-byte records, little endian.
+// Each ball is the mask of pins left standing after it, in the PinSet layout.
+struct ArchiveHeader {
+    static constexpr std::array<char, 8> expectedMagic{'B', 'W', 'L', 'A', 'R', 'C', 'H', '1'};
+    static constexpr uint32_t currentVersion = 1;
+
+    std::array<char, 8> magic = expectedMagic;
+    uint32_t version = currentVersion;
+    uint32_t recordSize = 64;
+    uint64_t recordCount = 0;
+    uint64_t reserved = 0;
+};
+
+struct ArchiveRecord {
+    uint64_t gameId = 0;
+    uint32_t bowlerId = 0;
+    uint16_t storedScore = 0;
+    uint8_t ballCount = 0;
+    uint8_t flags = 0;
+    std::array<uint16_t, 21> balls{};
+    std::array<uint8_t, 6> padding{};
+};
+
+static_assert(sizeof(ArchiveHeader) == 32);
+static_assert(sizeof(ArchiveRecord) == 64);
+
+// Maps a whole archive read-only; records are read in place.
+class ArchiveReader {
+    int fd = -1;
+    void* mapping = nullptr;
+    std::size_t mappedSize = 0;
+    std::span<const ArchiveRecord> records;
+
+public:
+    explicit ArchiveReader(const std::string& path);
+    ArchiveReader(const ArchiveReader&) = delete;
+    ArchiveReader& operator=(const ArchiveReader&) = delete;
+    ~ArchiveReader();
+
+    std::span<const ArchiveRecord> Records() const;
+
+    std::size_t Bytes() const;
+};
+
+// Appends records and fills in the header's record count on Close.
+class ArchiveWriter {
+    std::ofstream out;
+    uint64_t recordCount = 0;
+
+    // Writes the final header and closes the file; false if anything failed.
+    bool Finish() noexcept;
+
+public:
+    explicit ArchiveWriter(const std::string& path);
+    ArchiveWriter(const ArchiveWriter&) = delete;
+    ArchiveWriter& operator=(const ArchiveWriter&) = delete;
+    // Finishes the file if Close was not called, discarding any failure; call Close
+    // to find out.
+    ~ArchiveWriter();
+
+    void Write(std::span<const ArchiveRecord> records);
+
+    // Throws ArchiveException if any write failed.
+    void Close();
+};
+#endif //BOWLINGSIMULATOR_ARCHIVE_H
@@ -0,0 +1,59 @@
+#ifndef BOWLINGSIMULATOR_BALLMODEL_H
+#define BOWLINGSIMULATOR_BALLMODEL_H
+
+#include "GameStateSpace.h"
+#include "SkillModel.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// The chance of each pin count for a ball, by pins standing: Simulation's uniform
+// balls or a fitted bowler's SkillModel::Pinfall. The engines that play counts
+// rather than masks (RareEvent, Sweep and WinProbability) draw from it and work out
+// final scores over a GameStateSpace with it.
+class BallModel {
+public:
+    // Element k is the chance a ball knocks down k pins.
+    using Pinfall = std::array<double, 11>;
+    // By pins standing, 1 to 10.
+    using Table = std::array<Pinfall, 11>;
+    using Distribution = std::array<double, 301>;
+
+private:
+    Table pinfall{};
+
+public:
+    // Simulation's uniform balls: a number from 0 to 10, less the pins already down.
+    BallModel();
+
+    BallModel(const SkillModel& model, const SkillRecord& bowler);
+
+    explicit BallModel(const Table& pinfall);
+
+    const Pinfall& operator[](uint_fast8_t standing) const;
+
+    const Table& Pinfalls() const;
+
+    // Cumulative by pins standing, ending in infinity so a draw always stops.
+    Table Cumulative() const;
+
+    // Pins knocked down by one ball, from a row of Cumulative.
+    static uint_fast8_t Draw(const Pinfall& cumulative, std::mt19937_64& rng);
+
+    // Points still to come from each state of the space, indexed by state ID. Every
+    // transition leads to a higher ID, so one backward sweep sees each state's
+    // successors finished before the state itself.
+    std::vector<Distribution> Remaining(const GameStateSpace& space) const;
+};
+
+inline uint_fast8_t BallModel::Draw(const Pinfall& cumulative, std::mt19937_64& rng) {
+    const auto random = static_cast<double>(rng() >> 11) * 0x1p-53;
+    uint_fast8_t pins = 0;
+    while (random >= cumulative[pins])
+        ++pins;
+    return pins;
+}
+#endif //BOWLINGSIMULATOR_BALLMODEL_H
@@ -0,0 +1,58 @@
+#ifndef BOWLINGSIMULATOR_BOUNDEDQUEUE_H
+#define BOWLINGSIMULATOR_BOUNDEDQUEUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+// A blocking queue between pipeline stages. Push waits while the queue is full,
+// which is what pushes back on a faster producer; Pop returns nothing once the
+// queue has been closed and drained.
+template <typename T>
+class BoundedQueue {
+    std::mutex mutex;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+    std::deque<T> items;
+    std::size_t capacity;
+    bool closed = false;
+
+public:
+    explicit BoundedQueue(std::size_t capacity) : capacity{capacity ? capacity : 1} {
+    }
+
+    bool Push(T item) {
+        std::unique_lock lock{mutex};
+        notFull.wait(lock, [this] { return closed || items.size() < capacity; });
+        if (closed)
+            return false;
+        items.push_back(std::move(item));
+        lock.unlock();
+        notEmpty.notify_one();
+        return true;
+    }
+
+    std::optional<T> Pop() {
+        std::unique_lock lock{mutex};
+        notEmpty.wait(lock, [this] { return closed || !items.empty(); });
+        if (items.empty())
+            return std::nullopt;
+        auto item = std::move(items.front());
+        items.pop_front();
+        lock.unlock();
+        notFull.notify_one();
+        return item;
+    }
+
+    void Close() {
+        {
+            std::lock_guard lock{mutex};
+            closed = true;
+        }
+        notFull.notify_all();
+        notEmpty.notify_all();
+    }
+};
+#endif //BOWLINGSIMULATOR_BOUNDEDQUEUE_H
@@ -2,11 +2,16 @@
 #define BOWLINGSIMULATOR_FINALFRAME_H
 
 #include "interface/IFrame.h"
+#include "Frame.h"
+#include "PinSet.h"
 
 #include <memory>
+#include <type_traits>
 #include <variant>
 
-class FinalFrame : public IFrame {
+// Pins is stored, and the base picked, the same way as in BasicFrame.
+template <typename Pins>
+class BasicFinalFrame final : public BasicFrameBase<Pins> {
     enum class TurnState {
         NONE,
         ONE,
@@ -14,20 +19,124 @@ class FinalFrame : public IFrame {
         THREE
     };
 
-    std::unique_ptr<IPinSet> pins;
+    Pins pins{};
     TurnState turnState = TurnState::NONE;
     uint_fast8_t first = 0;
     uint_fast8_t second = 0;
     uint_fast8_t bonus = 0;
 
+    constexpr auto& Rack() {
+        if constexpr (std::is_same_v<Pins, PinSet>)
+            return pins;
+        else
+            return *pins;
+    }
+
+    constexpr const auto& Rack() const {
+        if constexpr (std::is_same_v<Pins, PinSet>)
+            return pins;
+        else
+            return *pins;
+    }
+
 public:
-    FinalFrame(std::unique_ptr<IPinSet>&& pins);
+    using Score_t = IFrame::Score_t;
+
+    constexpr BasicFinalFrame() = default;
 
-    void Bowled(const IPinSet& newPinState) override;
+    constexpr BasicFinalFrame(Pins&& pins) : pins{std::move(pins)} {
+    }
 
-    Score_t Score() const override;
+    constexpr void Bowled(const IPinSet& newPinState);
 
-    bool TurnEnded() const override;
+    constexpr Score_t Score() const;
+
+    constexpr bool TurnEnded() const;
+
+    // The balls read straight from the frame's state, without building a Score_t.
+    constexpr IFrame::Balls BallsBowled() const;
 };
 
+using FinalFrame = BasicFinalFrame<std::unique_ptr<IPinSet>>;
+using InlineFinalFrame = BasicFinalFrame<PinSet>;
+
+template <typename Pins>
+constexpr void BasicFinalFrame<Pins>::Bowled(const IPinSet &newPinState) {
+    if (TurnEnded())
+        throw FrameEndedException{"This frame has been completed"};
+    Rack() &= newPinState;
+    switch (turnState) {
+        case TurnState::NONE:
+            turnState = TurnState::ONE;
+            first = Rack().PinsDown();
+            break;
+        case TurnState::ONE:
+            turnState = TurnState::TWO;
+            if (first == 10) {
+                Rack().Reset();
+                Rack() &= newPinState;
+                second = Rack().PinsDown();
+            } else {
+                second = Rack().PinsDown() - first;
+            }
+            break;
+        case TurnState::TWO:
+            turnState = TurnState::THREE;
+            if (first == 10 && second < 10) {
+                bonus = Rack().PinsDown() - second;
+                break;
+            }
+            Rack().Reset();
+            Rack() &= newPinState;
+            bonus = Rack().PinsDown();
+            break;
+        case TurnState::THREE:
+            // TurnEnded() has already thrown.
+            break;
+    }
+}
+
+template <typename Pins>
+constexpr IFrame::Score_t BasicFinalFrame<Pins>::Score() const {
+    switch (turnState) {
+        case TurnState::NONE:
+            return {IFrame::Open{}};
+        case TurnState::ONE:
+            return {IFrame::Open{first, first, 0}};
+        case TurnState::TWO:
+            return {IFrame::Open{static_cast<uint_fast8_t>(first + second), first, second}};
+        case TurnState::THREE:
+            break;
+    }
+    if (first < 10)
+        return {IFrame::SpareWithBonus{first, bonus}};
+    if (second < 10 || bonus < 10)
+        return {IFrame::StrikeWithBonus{second, bonus}};
+    return {IFrame::ThreeStrikes{}};
+}
+
+template <typename Pins>
+constexpr bool BasicFinalFrame<Pins>::TurnEnded() const {
+    return turnState == TurnState::THREE ||
+           (turnState == TurnState::TWO && Rack().PinsDown() < 10 && first < 10);
+}
+
+template <typename Pins>
+constexpr IFrame::Balls BasicFinalFrame<Pins>::BallsBowled() const {
+    switch (turnState) {
+        case TurnState::NONE:
+            return {};
+        case TurnState::ONE:
+            return {first, {first}, 1};
+        case TurnState::TWO:
+            return {static_cast<uint_fast8_t>(first + second), {first, second}, 2};
+        case TurnState::THREE:
+            break;
+    }
+    return {static_cast<uint_fast8_t>(first + second + bonus), {first, second, bonus}, 3};
+}
+
+extern template class BasicFinalFrame<std::unique_ptr<IPinSet>>;
+extern template class BasicFinalFrame<PinSet>;
+
 #endif //BOWLINGSIMULATOR_FINALFRAME_H
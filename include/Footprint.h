@@ -0,0 +1,26 @@
+#ifndef BOWLINGSIMULATOR_FOOTPRINT_H
+#define BOWLINGSIMULATOR_FOOTPRINT_H
+
+#include "AllocationTracker.h"
+#include "Simulation.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+struct TypeFootprint {
+    const char* name;
+    std::size_t size;
+    std::size_t alignment;
+};
+
+// What a game costs in memory: the size of every engine type, and what playing
+// games actually allocates once AllocationTracker is installed.
+class Footprint {
+public:
+    static std::span<const TypeFootprint> Types();
+
+    // The calling thread's allocations while playing games on the engine.
+    static AllocationStats Games(SimulationEngine engine, uint_fast64_t games);
+};
+#endif //BOWLINGSIMULATOR_FOOTPRINT_H
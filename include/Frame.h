@@ -2,30 +2,127 @@
 #define BOWLINGSIMULATOR_FRAME_H
 
 #include "interface/IFrame.h"
+#include "PinSet.h"
+#include "ResourceAllocated.h"
 
 #include <memory>
+#include <type_traits>
 
-class Frame : public IFrame {
+// What a frame derives from. With its rack behind a pointer it is an IFrame that
+// HeapFrames builds in a memory resource; with a PinSet inline it is a plain value
+// with no vtable, only ever called through InlineFrames::Visit.
+template <typename Pins>
+class BasicFrameBase : public IFrame, public ResourceAllocated {
+};
+
+template <>
+class BasicFrameBase<PinSet> {
+};
+
+// Pins is where the frame keeps its rack: a std::unique_ptr<IPinSet>, so a test
+// can hand in a mock, or a PinSet held inline, which needs no allocation and
+// makes the frame usable in constant expressions.
+template <typename Pins>
+class BasicFrame final : public BasicFrameBase<Pins> {
     enum class TurnState {
         NONE,
         ONE,
         TWO,
     };
 
-    std::unique_ptr<IPinSet> pins;
+    Pins pins{};
     TurnState turnState = TurnState::NONE;
     uint_fast8_t first = 0;
     uint_fast8_t second = 0;
 
+    constexpr auto& Rack() {
+        if constexpr (std::is_same_v<Pins, PinSet>)
+            return pins;
+        else
+            return *pins;
+    }
+
+    constexpr const auto& Rack() const {
+        if constexpr (std::is_same_v<Pins, PinSet>)
+            return pins;
+        else
+            return *pins;
+    }
+
 public:
+    using Score_t = IFrame::Score_t;
+
+    constexpr BasicFrame() = default;
 
-    Frame(std::unique_ptr<IPinSet>&& pins);
+    constexpr BasicFrame(Pins&& pins) : pins{std::move(pins)} {
+    }
 
-    void Bowled(const IPinSet& newPins) override;
+    constexpr void Bowled(const IPinSet& newPins);
 
-    bool TurnEnded() const override;
+    constexpr bool TurnEnded() const;
 
-    Score_t Score() const override;
+    constexpr Score_t Score() const;
+
+    // The balls read straight from the frame's state, without building a Score_t.
+    constexpr IFrame::Balls BallsBowled() const;
 };
 
+using Frame = BasicFrame<std::unique_ptr<IPinSet>>;
+using InlineFrame = BasicFrame<PinSet>;
+
+template <typename Pins>
+constexpr void BasicFrame<Pins>::Bowled(const IPinSet& newPins) {
+    if (TurnEnded())
+        throw FrameEndedException{"This frame has ended"};
+    Rack() &= newPins;
+    switch (turnState) {
+        case TurnState::NONE:
+            turnState = TurnState::ONE;
+            first = Rack().PinsDown();
+            break;
+        case TurnState::ONE:
+            turnState = TurnState::TWO;
+            second = Rack().PinsDown() - first;
+            break;
+        case TurnState::TWO:
+            // TurnEnded() has already thrown.
+            break;
+    }
+}
+
+template <typename Pins>
+constexpr bool BasicFrame<Pins>::TurnEnded() const {
+    if (turnState == TurnState::NONE)
+        return false;
+    return turnState == TurnState::TWO || Rack().PinsDown() == 10;
+}
+
+template <typename Pins>
+constexpr IFrame::Score_t BasicFrame<Pins>::Score() const {
+    const auto result = Rack().PinsDown();
+    if (result == 10) {
+        if (turnState == TurnState::TWO)
+            return {IFrame::Spare{first}};
+        else
+            return {IFrame::Strike{}};
+    }
+    return {IFrame::Open{result, first, second}};
+}
+
+template <typename Pins>
+constexpr IFrame::Balls BasicFrame<Pins>::BallsBowled() const {
+    switch (turnState) {
+        case TurnState::NONE:
+            return {};
+        case TurnState::ONE:
+            return {first, {first}, 1};
+        case TurnState::TWO:
+            break;
+    }
+    return {static_cast<uint_fast8_t>(first + second), {first, second}, 2};
+}
+
+extern template class BasicFrame<std::unique_ptr<IPinSet>>;
+extern template class BasicFrame<PinSet>;
+
 #endif //BOWLINGSIMULATOR_FRAME_H
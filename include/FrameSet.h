@@ -2,18 +2,237 @@
 #define BOWLINGSIMULATOR_FRAMESET_H
 
 #include "interface/IFrame.h"
+#include "FinalFrame.h"
+#include "Frame.h"
 
+#include <algorithm>
 #include <array>
+#include <concepts>
 #include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <variant>
 
-class FrameSet {
+// Ten frames behind unique_ptrs to IFrame, built in a memory resource or handed
+// in (as mocks, in the tests). Calls go through IFrame.
+class HeapFrames {
     std::array<std::unique_ptr<IFrame>, 10> frames;
+
+public:
+    static constexpr std::size_t size = 10;
+
+    HeapFrames(std::array<std::unique_ptr<IFrame>, 10>&& frames);
+    explicit HeapFrames(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    template <typename F>
+    decltype(auto) Visit(std::size_t frame, F&& fn) const {
+        return fn(*frames[frame]);
+    }
+};
+
+// Ten frames held by value: the closed set of frame types the engine plays games
+// with. Visit calls straight into the concrete (final) frame type, so nothing is
+// allocated or dispatched virtually, and the whole game can be played in a constant
+// expression. IFrame is only needed for HeapFrames' mocks.
+class InlineFrames {
+    std::array<InlineFrame, 9> frames{};
+    InlineFinalFrame finalFrame{};
+
+public:
+    static constexpr std::size_t size = 10;
+
+    template <typename F>
+    constexpr decltype(auto) Visit(std::size_t frame, F&& fn) {
+        if (frame < frames.size())
+            return fn(frames[frame]);
+        return fn(finalFrame);
+    }
+
+    template <typename F>
+    constexpr decltype(auto) Visit(std::size_t frame, F&& fn) const {
+        if (frame < frames.size())
+            return fn(frames[frame]);
+        return fn(finalFrame);
+    }
+};
+
+// The balls of a frame from its Score_t, for frames only reachable through IFrame.
+class FrameBallsVisitor {
+public:
+    using Balls = IFrame::Balls;
+
+    constexpr Balls operator()(const IFrame::Open& score) const;
+    constexpr Balls operator()(const IFrame::Strike&) const;
+    constexpr Balls operator()(const IFrame::Spare& score) const;
+    constexpr Balls operator()(const IFrame::SpareWithBonus& score) const;
+    constexpr Balls operator()(const IFrame::ThreeStrikes&) const;
+    constexpr Balls operator()(const IFrame::StrikeWithBonus& score) const;
+};
+
+template <typename Frames>
+class BasicFrameSet {
+    Frames frames;
     uint_fast8_t currentFrame = 0;
+    uint_fast8_t currentBall = 0;
+    mutable std::array<uint_fast16_t, 10> frameScores{};
+    mutable uint_fast8_t firstStaleFrame = 0;
+
+    // One visit per frame: the concrete frames report their balls directly, and only
+    // an IFrame (HeapFrames' mocks) goes through Score() and FrameBallsVisitor.
+    constexpr IFrame::Balls BallsBowled(std::size_t frame) const;
 
 public:
-    FrameSet(decltype(frames)&& frames);
-    void Bowled(const IPinSet& pinSet);
-    bool Ended() const;
-    uint_fast16_t Score() const;
+    template <typename... Args>
+        requires std::constructible_from<Frames, Args&&...>
+    constexpr explicit BasicFrameSet(Args&&... args) : frames{std::forward<Args>(args)...} {
+    }
+
+    constexpr void Bowled(const IPinSet& pinSet);
+    constexpr bool Ended() const;
+    constexpr uint_fast8_t CurrentFrame() const;
+    // The balls bowled so far in a frame; count is 0 for frames not yet started.
+    constexpr FrameBallsVisitor::Balls FrameBalls(uint_fast8_t frame) const;
+    constexpr uint_fast16_t Score() const;
+    // The running score after each frame, redone from the oldest frame a ball since
+    // the last call could have changed. It is const but refills a mutable cache, so
+    // it is not safe to call on one FrameSet from two threads, even if neither bowls;
+    // hand other threads a copy of the array instead.
+    const std::array<uint_fast16_t, 10>& FrameScores() const;
 };
+
+using FrameSet = BasicFrameSet<HeapFrames>;
+using InlineFrameSet = BasicFrameSet<InlineFrames>;
+
+template <typename Frames>
+constexpr void BasicFrameSet<Frames>::Bowled(const IPinSet& pinSet) {
+    if (Ended())
+        throw FrameEndedException{"This game has ended"};
+    const auto turnEnded = frames.Visit(currentFrame, [&](auto& frame) {
+        frame.Bowled(pinSet);
+        return frame.TurnEnded();
+    });
+    // A ball can only be a bonus for the two frames before the one it was bowled in.
+    // The cache is mutable, and GCC will not read mutable members in a constant
+    // expression, so FrameScores() is a runtime-only call.
+    if (!std::is_constant_evaluated())
+        firstStaleFrame = std::min<uint_fast8_t>(firstStaleFrame, currentFrame < 2 ? 0 : currentFrame - 2);
+    if (turnEnded) {
+        ++currentFrame;
+        currentBall = 0;
+    } else {
+        ++currentBall;
+    }
+}
+
+template <typename Frames>
+constexpr bool BasicFrameSet<Frames>::Ended() const {
+    return currentFrame == Frames::size;
+}
+
+template <typename Frames>
+constexpr uint_fast8_t BasicFrameSet<Frames>::CurrentFrame() const {
+    return currentFrame;
+}
+
+template <typename Frames>
+constexpr FrameBallsVisitor::Balls BasicFrameSet<Frames>::FrameBalls(uint_fast8_t frame) const {
+    if (frame > currentFrame || (frame == currentFrame && currentBall == 0))
+        return {};
+    auto balls = BallsBowled(frame);
+    if (frame == currentFrame)
+        balls.count = currentBall;
+    return balls;
+}
+
+template <typename Frames>
+constexpr IFrame::Balls BasicFrameSet<Frames>::BallsBowled(std::size_t frame) const {
+    return frames.Visit(frame, [](const auto& frame) {
+        if constexpr (requires { frame.BallsBowled(); })
+            return frame.BallsBowled();
+        else
+            return std::visit(FrameBallsVisitor{}, frame.Score());
+    });
+}
+
+// One pass: each frame adds its own total, and each ball adds its pins once more
+// for every strike or spare still owed a bonus ball.
+template <typename Frames>
+constexpr uint_fast16_t BasicFrameSet<Frames>::Score() const {
+    const auto lastFrame = std::min<uint_fast8_t>(currentFrame, Frames::size - 1);
+    uint_fast16_t total = 0;
+    uint_fast8_t nextBonus = 0;
+    uint_fast8_t afterNextBonus = 0;
+    for (uint_fast8_t i = 0; i <= lastFrame; ++i) {
+        const auto balls = BallsBowled(i);
+        total += balls.total;
+        for (uint_fast8_t j = 0; j < balls.count; ++j) {
+            total += balls.pins[j] * nextBonus;
+            nextBonus = afterNextBonus;
+            afterNextBonus = 0;
+        }
+        if (i < Frames::size - 1 && balls.total == 10) {
+            ++nextBonus;
+            if (balls.count == 1)
+                ++afterNextBonus;
+        }
+    }
+    return total;
+}
+
+template <typename Frames>
+const std::array<uint_fast16_t, 10>& BasicFrameSet<Frames>::FrameScores() const {
+    if (firstStaleFrame == Frames::size)
+        return frameScores;
+    const auto lastFrame = std::min<uint_fast8_t>(currentFrame, Frames::size - 1);
+    std::array<IFrame::Balls, 10> balls{};
+    for (auto i = firstStaleFrame; i <= lastFrame; ++i)
+        balls[i] = BallsBowled(i);
+    const auto bonus = [&](uint_fast8_t frame, uint_fast8_t count) {
+        uint_fast16_t total = 0;
+        for (auto i = frame + 1; count && i <= lastFrame; ++i)
+            for (auto j = 0; count && j < balls[i].count; ++j, --count)
+                total += balls[i].pins[j];
+        return total;
+    };
+    uint_fast16_t total = firstStaleFrame ? frameScores[firstStaleFrame - 1] : 0;
+    for (auto i = firstStaleFrame; i < Frames::size; ++i) {
+        if (i <= lastFrame) {
+            const auto& frame = balls[i];
+            total += frame.total;
+            if (i < Frames::size - 1 && frame.total == 10)
+                total += bonus(i, frame.count == 1 ? 2 : 1);
+        }
+        frameScores[i] = total;
+    }
+    firstStaleFrame = Frames::size;
+    return frameScores;
+}
+
+constexpr FrameBallsVisitor::Balls FrameBallsVisitor::operator()(const IFrame::Open& score) const {
+    return {score.total, {score.first, score.second}, 2};
+}
+
+constexpr FrameBallsVisitor::Balls FrameBallsVisitor::operator()(const IFrame::Strike&) const {
+    return {10, {10}, 1};
+}
+
+constexpr FrameBallsVisitor::Balls FrameBallsVisitor::operator()(const IFrame::Spare& score) const {
+    return {10, {score.first, static_cast<uint_fast8_t>(10 - score.first)}, 2};
+}
+
+constexpr FrameBallsVisitor::Balls FrameBallsVisitor::operator()(const IFrame::SpareWithBonus& score) const {
+    return {static_cast<uint_fast8_t>(10 + score.bonus), {score.first, static_cast<uint_fast8_t>(10 - score.first), score.bonus}, 3};
+}
+
+constexpr FrameBallsVisitor::Balls FrameBallsVisitor::operator()(const IFrame::ThreeStrikes&) const {
+    return {30, {10, 10, 10}, 3};
+}
+
+constexpr FrameBallsVisitor::Balls FrameBallsVisitor::operator()(const IFrame::StrikeWithBonus& score) const {
+    return {static_cast<uint_fast8_t>(10 + score.second + score.bonus), {10, score.second, score.bonus}, 3};
+}
+
+extern template class BasicFrameSet<HeapFrames>;
+extern template class BasicFrameSet<InlineFrames>;
+
 #endif //BOWLINGSIMULATOR_FRAMESET_H
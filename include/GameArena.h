@@ -0,0 +1,24 @@
+#ifndef BOWLINGSIMULATOR_GAMEARENA_H
+#define BOWLINGSIMULATOR_GAMEARENA_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+// A monotonic arena sized for a batch of standard games. Every FrameSet built on
+// Resource() must be destroyed before Reset() rewinds the arena for the next batch.
+class GameArena {
+    std::vector<std::byte> buffer;
+    std::pmr::monotonic_buffer_resource arena;
+
+public:
+    static std::size_t BytesPerGame();
+
+    explicit GameArena(std::size_t gamesPerBatch,
+                       std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+    std::pmr::memory_resource* Resource();
+
+    void Reset();
+};
+#endif //BOWLINGSIMULATOR_GAMEARENA_H
@@ -0,0 +1,42 @@
+#ifndef BOWLINGSIMULATOR_GAMEBATCH_H
+#define BOWLINGSIMULATOR_GAMEBATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+using PinMask = uint16_t;
+
+// The state of many games kept as parallel arrays, one entry per game, so one ball
+// for every game is a single branch-free pass the compiler can vectorize. Masks use
+// the PinSet layout and a ball mask means the same as the PinSet passed to
+// FrameSet::Bowled: pins cleared in it are knocked down. Games that have ended
+// ignore their ball. Every field is 16 bits wide so all arrays share a lane width.
+class GameBatch {
+    std::vector<uint16_t> frame;
+    std::vector<uint16_t> turnState;
+    std::vector<uint16_t> first;
+    std::vector<uint16_t> second;
+    std::vector<uint16_t> bonus;
+    std::vector<uint16_t> pins;
+    std::vector<uint16_t> bonusNext;
+    std::vector<uint16_t> bonusAfter;
+    std::vector<uint16_t> score;
+
+public:
+    explicit GameBatch(std::size_t games);
+
+    std::size_t Size() const;
+
+    void BowlAll(std::span<const PinMask> balls);
+
+    void ScoreAll(std::span<uint16_t> out) const;
+
+    bool Ended(std::size_t game) const;
+
+    std::size_t EndedCount() const;
+
+    void Reset();
+};
+#endif //BOWLINGSIMULATOR_GAMEBATCH_H
@@ -0,0 +1,87 @@
+#ifndef BOWLINGSIMULATOR_GAMESESSION_H
+#define BOWLINGSIMULATOR_GAMESESSION_H
+
+#include "FrameSet.h"
+
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+struct ScoreUpdate {
+    uint_fast8_t frame = 0;
+    uint_fast8_t turn = 0;
+    uint_fast16_t score = 0;
+    bool ended = false;
+};
+
+// A lane's game as a coroutine: it awaits each ball, feeds it to the InlineFrameSet
+// and yields the updated score. The coroutine frame is allocated from the memory
+// resource passed after std::allocator_arg, so a pool resource keeps many sessions
+// off the heap.
+class GameSession {
+public:
+    struct promise_type;
+
+    struct NextBall {};
+
+    struct BallAwaiter {
+        promise_type& promise;
+
+        bool await_ready() const noexcept;
+        void await_suspend(std::coroutine_handle<promise_type>) const noexcept {}
+        const IPinSet& await_resume() const noexcept;
+    };
+
+    struct promise_type {
+        const IPinSet* ball = nullptr;
+        ScoreUpdate update{};
+        std::exception_ptr exception;
+
+        GameSession get_return_object();
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        std::suspend_always yield_value(const ScoreUpdate& newUpdate) noexcept;
+        BallAwaiter await_transform(NextBall) noexcept { return {*this}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept;
+
+        // Spelled out for Play rather than templated over its parameters: GCC's
+        // -Wmismatched-new-delete does not pair a templated new with the delete below.
+        static void* operator new(std::size_t size, std::allocator_arg_t, std::pmr::memory_resource& resource,
+                                  InlineFrameSet&);
+        static void* operator new(std::size_t size);
+        static void operator delete(void* frame, std::size_t size);
+
+    private:
+        static void* Allocate(std::size_t size, std::pmr::memory_resource& resource);
+    };
+
+private:
+    std::coroutine_handle<promise_type> handle;
+
+    explicit GameSession(std::coroutine_handle<promise_type> handle);
+
+public:
+    GameSession(GameSession&& other) noexcept;
+    GameSession& operator=(GameSession&& other) noexcept;
+    ~GameSession();
+
+    static GameSession Play(std::allocator_arg_t, std::pmr::memory_resource& resource, InlineFrameSet& frameSet);
+    static GameSession Play(InlineFrameSet& frameSet);
+
+    const ScoreUpdate& Bowled(const IPinSet& pins);
+    bool Ended() const;
+    const ScoreUpdate& LastUpdate() const;
+};
+
+inline bool GameSession::BallAwaiter::await_ready() const noexcept {
+    return promise.ball != nullptr;
+}
+
+inline const IPinSet& GameSession::BallAwaiter::await_resume() const noexcept {
+    return *std::exchange(promise.ball, nullptr);
+}
+#endif //BOWLINGSIMULATOR_GAMESESSION_H
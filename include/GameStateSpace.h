@@ -0,0 +1,63 @@
+#ifndef BOWLINGSIMULATOR_GAMESTATESPACE_H
+#define BOWLINGSIMULATOR_GAMESTATESPACE_H
+
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <vector>
+
+// Variations on the rules. GameStateTable is generated from the defaults.
+struct GameRules {
+    // The tenth frame bowls fill balls after a strike or spare. Without them it is
+    // an ordinary frame, and bonuses still owed at the end of the game lapse.
+    bool tenthFrameBonus = true;
+
+    auto operator<=>(const GameRules&) const = default;
+};
+
+// Every state a count-only game can reach, where a ball is just the number of
+// pins it knocks down. IDs are dense and ordered by (frame, ball), so state 0 is
+// the start of the game, the last state is the end of it and every transition
+// leads to a higher ID.
+class GameStateSpace {
+public:
+    struct State {
+        uint8_t frame = 0;
+        uint8_t ball = 0;
+        uint8_t standing = 10;
+        // Extra times the next ball and the one after it count, owed to earlier strikes and spares.
+        uint8_t bonusNext = 0;
+        uint8_t bonusAfter = 0;
+        // The tenth frame's first ball was a strike, so a third ball will follow.
+        bool fillBall = false;
+
+        auto operator<=>(const State&) const = default;
+    };
+
+    static constexpr uint16_t invalid = 0xFFFF;
+
+    explicit GameStateSpace(GameRules rules = {});
+
+    std::size_t Size() const;
+
+    uint16_t Start() const;
+
+    uint16_t End() const;
+
+    const State& At(uint16_t id) const;
+
+    uint16_t Next(uint16_t id, uint_fast8_t pins) const;
+
+    uint_fast8_t Points(uint16_t id, uint_fast8_t pins) const;
+
+    void WriteHeader(std::ostream& out) const;
+
+private:
+    std::vector<State> states;
+    std::vector<std::array<uint16_t, 11>> next;
+    std::vector<std::array<uint8_t, 11>> points;
+};
+
+#endif //BOWLINGSIMULATOR_GAMESTATESPACE_H
@@ -0,0 +1,520 @@
+// Generated by GenerateGameStates from the Frame and FinalFrame rules. Do not edit.
+#ifndef BOWLINGSIMULATOR_GAMESTATETABLE_H
+#define BOWLINGSIMULATOR_GAMESTATETABLE_H
+
+#include <array>
+#include <cstdint>
+
+struct GameStateTable {
+    static constexpr uint16_t stateCount = 239;
+    static constexpr uint16_t start = 0;
+    static constexpr uint16_t end = 238;
+    static constexpr uint16_t invalid = 65535;
+
+    static constexpr std::array<uint8_t, stateCount> frame{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+            3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+            6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+            7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+            8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10};
+    static constexpr std::array<uint8_t, stateCount> standing{10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 10, 10, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5,
+            6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 10, 10, 10, 10, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5,
+            6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 10, 10, 10, 10, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5,
+            6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 10, 10, 10, 10, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5,
+            6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 10, 10, 10, 10, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5,
+            6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 10, 10, 10, 10, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5,
+            6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 10, 10, 10, 10, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5,
+            6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 10, 10, 10, 10, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5,
+            6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 10, 10, 10, 10, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5,
+            6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 10, 10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 0};
+
+    static constexpr std::array<std::array<uint16_t, 11>, stateCount> next{{
+        {10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 13},
+        {11, 12, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {11, 11, 12, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {11, 11, 11, 12, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {11, 11, 11, 11, 12, 65535, 65535, 65535, 65535, 65535, 65535},
+        {11, 11, 11, 11, 11, 12, 65535, 65535, 65535, 65535, 65535},
+        {11, 11, 11, 11, 11, 11, 12, 65535, 65535, 65535, 65535},
+        {11, 11, 11, 11, 11, 11, 11, 12, 65535, 65535, 65535},
+        {11, 11, 11, 11, 11, 11, 11, 11, 12, 65535, 65535},
+        {11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 65535},
+        {11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12},
+        {32, 30, 28, 26, 24, 22, 20, 18, 16, 14, 36},
+        {32, 30, 28, 26, 24, 22, 20, 18, 16, 14, 36},
+        {33, 31, 29, 27, 25, 23, 21, 19, 17, 15, 37},
+        {34, 35, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {34, 35, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {34, 34, 35, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {34, 34, 35, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {34, 34, 34, 35, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {34, 34, 34, 35, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {34, 34, 34, 34, 35, 65535, 65535, 65535, 65535, 65535, 65535},
+        {34, 34, 34, 34, 35, 65535, 65535, 65535, 65535, 65535, 65535},
+        {34, 34, 34, 34, 34, 35, 65535, 65535, 65535, 65535, 65535},
+        {34, 34, 34, 34, 34, 35, 65535, 65535, 65535, 65535, 65535},
+        {34, 34, 34, 34, 34, 34, 35, 65535, 65535, 65535, 65535},
+        {34, 34, 34, 34, 34, 34, 35, 65535, 65535, 65535, 65535},
+        {34, 34, 34, 34, 34, 34, 34, 35, 65535, 65535, 65535},
+        {34, 34, 34, 34, 34, 34, 34, 35, 65535, 65535, 65535},
+        {34, 34, 34, 34, 34, 34, 34, 34, 35, 65535, 65535},
+        {34, 34, 34, 34, 34, 34, 34, 34, 35, 65535, 65535},
+        {34, 34, 34, 34, 34, 34, 34, 34, 34, 35, 65535},
+        {34, 34, 34, 34, 34, 34, 34, 34, 34, 35, 65535},
+        {34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 35},
+        {34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 35},
+        {56, 54, 52, 50, 48, 46, 44, 42, 40, 38, 60},
+        {56, 54, 52, 50, 48, 46, 44, 42, 40, 38, 60},
+        {57, 55, 53, 51, 49, 47, 45, 43, 41, 39, 61},
+        {57, 55, 53, 51, 49, 47, 45, 43, 41, 39, 61},
+        {58, 59, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {58, 59, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {58, 58, 59, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {58, 58, 59, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {58, 58, 58, 59, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {58, 58, 58, 59, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {58, 58, 58, 58, 59, 65535, 65535, 65535, 65535, 65535, 65535},
+        {58, 58, 58, 58, 59, 65535, 65535, 65535, 65535, 65535, 65535},
+        {58, 58, 58, 58, 58, 59, 65535, 65535, 65535, 65535, 65535},
+        {58, 58, 58, 58, 58, 59, 65535, 65535, 65535, 65535, 65535},
+        {58, 58, 58, 58, 58, 58, 59, 65535, 65535, 65535, 65535},
+        {58, 58, 58, 58, 58, 58, 59, 65535, 65535, 65535, 65535},
+        {58, 58, 58, 58, 58, 58, 58, 59, 65535, 65535, 65535},
+        {58, 58, 58, 58, 58, 58, 58, 59, 65535, 65535, 65535},
+        {58, 58, 58, 58, 58, 58, 58, 58, 59, 65535, 65535},
+        {58, 58, 58, 58, 58, 58, 58, 58, 59, 65535, 65535},
+        {58, 58, 58, 58, 58, 58, 58, 58, 58, 59, 65535},
+        {58, 58, 58, 58, 58, 58, 58, 58, 58, 59, 65535},
+        {58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 59},
+        {58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 59},
+        {80, 78, 76, 74, 72, 70, 68, 66, 64, 62, 84},
+        {80, 78, 76, 74, 72, 70, 68, 66, 64, 62, 84},
+        {81, 79, 77, 75, 73, 71, 69, 67, 65, 63, 85},
+        {81, 79, 77, 75, 73, 71, 69, 67, 65, 63, 85},
+        {82, 83, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {82, 83, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {82, 82, 83, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {82, 82, 83, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {82, 82, 82, 83, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {82, 82, 82, 83, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {82, 82, 82, 82, 83, 65535, 65535, 65535, 65535, 65535, 65535},
+        {82, 82, 82, 82, 83, 65535, 65535, 65535, 65535, 65535, 65535},
+        {82, 82, 82, 82, 82, 83, 65535, 65535, 65535, 65535, 65535},
+        {82, 82, 82, 82, 82, 83, 65535, 65535, 65535, 65535, 65535},
+        {82, 82, 82, 82, 82, 82, 83, 65535, 65535, 65535, 65535},
+        {82, 82, 82, 82, 82, 82, 83, 65535, 65535, 65535, 65535},
+        {82, 82, 82, 82, 82, 82, 82, 83, 65535, 65535, 65535},
+        {82, 82, 82, 82, 82, 82, 82, 83, 65535, 65535, 65535},
+        {82, 82, 82, 82, 82, 82, 82, 82, 83, 65535, 65535},
+        {82, 82, 82, 82, 82, 82, 82, 82, 83, 65535, 65535},
+        {82, 82, 82, 82, 82, 82, 82, 82, 82, 83, 65535},
+        {82, 82, 82, 82, 82, 82, 82, 82, 82, 83, 65535},
+        {82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 83},
+        {82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 83},
+        {104, 102, 100, 98, 96, 94, 92, 90, 88, 86, 108},
+        {104, 102, 100, 98, 96, 94, 92, 90, 88, 86, 108},
+        {105, 103, 101, 99, 97, 95, 93, 91, 89, 87, 109},
+        {105, 103, 101, 99, 97, 95, 93, 91, 89, 87, 109},
+        {106, 107, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {106, 107, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {106, 106, 107, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {106, 106, 107, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {106, 106, 106, 107, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {106, 106, 106, 107, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {106, 106, 106, 106, 107, 65535, 65535, 65535, 65535, 65535, 65535},
+        {106, 106, 106, 106, 107, 65535, 65535, 65535, 65535, 65535, 65535},
+        {106, 106, 106, 106, 106, 107, 65535, 65535, 65535, 65535, 65535},
+        {106, 106, 106, 106, 106, 107, 65535, 65535, 65535, 65535, 65535},
+        {106, 106, 106, 106, 106, 106, 107, 65535, 65535, 65535, 65535},
+        {106, 106, 106, 106, 106, 106, 107, 65535, 65535, 65535, 65535},
+        {106, 106, 106, 106, 106, 106, 106, 107, 65535, 65535, 65535},
+        {106, 106, 106, 106, 106, 106, 106, 107, 65535, 65535, 65535},
+        {106, 106, 106, 106, 106, 106, 106, 106, 107, 65535, 65535},
+        {106, 106, 106, 106, 106, 106, 106, 106, 107, 65535, 65535},
+        {106, 106, 106, 106, 106, 106, 106, 106, 106, 107, 65535},
+        {106, 106, 106, 106, 106, 106, 106, 106, 106, 107, 65535},
+        {106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 107},
+        {106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 107},
+        {128, 126, 124, 122, 120, 118, 116, 114, 112, 110, 132},
+        {128, 126, 124, 122, 120, 118, 116, 114, 112, 110, 132},
+        {129, 127, 125, 123, 121, 119, 117, 115, 113, 111, 133},
+        {129, 127, 125, 123, 121, 119, 117, 115, 113, 111, 133},
+        {130, 131, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {130, 131, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {130, 130, 131, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {130, 130, 131, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {130, 130, 130, 131, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {130, 130, 130, 131, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {130, 130, 130, 130, 131, 65535, 65535, 65535, 65535, 65535, 65535},
+        {130, 130, 130, 130, 131, 65535, 65535, 65535, 65535, 65535, 65535},
+        {130, 130, 130, 130, 130, 131, 65535, 65535, 65535, 65535, 65535},
+        {130, 130, 130, 130, 130, 131, 65535, 65535, 65535, 65535, 65535},
+        {130, 130, 130, 130, 130, 130, 131, 65535, 65535, 65535, 65535},
+        {130, 130, 130, 130, 130, 130, 131, 65535, 65535, 65535, 65535},
+        {130, 130, 130, 130, 130, 130, 130, 131, 65535, 65535, 65535},
+        {130, 130, 130, 130, 130, 130, 130, 131, 65535, 65535, 65535},
+        {130, 130, 130, 130, 130, 130, 130, 130, 131, 65535, 65535},
+        {130, 130, 130, 130, 130, 130, 130, 130, 131, 65535, 65535},
+        {130, 130, 130, 130, 130, 130, 130, 130, 130, 131, 65535},
+        {130, 130, 130, 130, 130, 130, 130, 130, 130, 131, 65535},
+        {130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 131},
+        {130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 131},
+        {152, 150, 148, 146, 144, 142, 140, 138, 136, 134, 156},
+        {152, 150, 148, 146, 144, 142, 140, 138, 136, 134, 156},
+        {153, 151, 149, 147, 145, 143, 141, 139, 137, 135, 157},
+        {153, 151, 149, 147, 145, 143, 141, 139, 137, 135, 157},
+        {154, 155, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {154, 155, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {154, 154, 155, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {154, 154, 155, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {154, 154, 154, 155, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {154, 154, 154, 155, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {154, 154, 154, 154, 155, 65535, 65535, 65535, 65535, 65535, 65535},
+        {154, 154, 154, 154, 155, 65535, 65535, 65535, 65535, 65535, 65535},
+        {154, 154, 154, 154, 154, 155, 65535, 65535, 65535, 65535, 65535},
+        {154, 154, 154, 154, 154, 155, 65535, 65535, 65535, 65535, 65535},
+        {154, 154, 154, 154, 154, 154, 155, 65535, 65535, 65535, 65535},
+        {154, 154, 154, 154, 154, 154, 155, 65535, 65535, 65535, 65535},
+        {154, 154, 154, 154, 154, 154, 154, 155, 65535, 65535, 65535},
+        {154, 154, 154, 154, 154, 154, 154, 155, 65535, 65535, 65535},
+        {154, 154, 154, 154, 154, 154, 154, 154, 155, 65535, 65535},
+        {154, 154, 154, 154, 154, 154, 154, 154, 155, 65535, 65535},
+        {154, 154, 154, 154, 154, 154, 154, 154, 154, 155, 65535},
+        {154, 154, 154, 154, 154, 154, 154, 154, 154, 155, 65535},
+        {154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 155},
+        {154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 155},
+        {176, 174, 172, 170, 168, 166, 164, 162, 160, 158, 180},
+        {176, 174, 172, 170, 168, 166, 164, 162, 160, 158, 180},
+        {177, 175, 173, 171, 169, 167, 165, 163, 161, 159, 181},
+        {177, 175, 173, 171, 169, 167, 165, 163, 161, 159, 181},
+        {178, 179, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {178, 179, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {178, 178, 179, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {178, 178, 179, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {178, 178, 178, 179, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {178, 178, 178, 179, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {178, 178, 178, 178, 179, 65535, 65535, 65535, 65535, 65535, 65535},
+        {178, 178, 178, 178, 179, 65535, 65535, 65535, 65535, 65535, 65535},
+        {178, 178, 178, 178, 178, 179, 65535, 65535, 65535, 65535, 65535},
+        {178, 178, 178, 178, 178, 179, 65535, 65535, 65535, 65535, 65535},
+        {178, 178, 178, 178, 178, 178, 179, 65535, 65535, 65535, 65535},
+        {178, 178, 178, 178, 178, 178, 179, 65535, 65535, 65535, 65535},
+        {178, 178, 178, 178, 178, 178, 178, 179, 65535, 65535, 65535},
+        {178, 178, 178, 178, 178, 178, 178, 179, 65535, 65535, 65535},
+        {178, 178, 178, 178, 178, 178, 178, 178, 179, 65535, 65535},
+        {178, 178, 178, 178, 178, 178, 178, 178, 179, 65535, 65535},
+        {178, 178, 178, 178, 178, 178, 178, 178, 178, 179, 65535},
+        {178, 178, 178, 178, 178, 178, 178, 178, 178, 179, 65535},
+        {178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 179},
+        {178, 178, 178, 178, 178, 178, 178, 178, 178, 178, 179},
+        {200, 198, 196, 194, 192, 190, 188, 186, 184, 182, 204},
+        {200, 198, 196, 194, 192, 190, 188, 186, 184, 182, 204},
+        {201, 199, 197, 195, 193, 191, 189, 187, 185, 183, 205},
+        {201, 199, 197, 195, 193, 191, 189, 187, 185, 183, 205},
+        {202, 203, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {202, 203, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {202, 202, 203, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {202, 202, 203, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {202, 202, 202, 203, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {202, 202, 202, 203, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {202, 202, 202, 202, 203, 65535, 65535, 65535, 65535, 65535, 65535},
+        {202, 202, 202, 202, 203, 65535, 65535, 65535, 65535, 65535, 65535},
+        {202, 202, 202, 202, 202, 203, 65535, 65535, 65535, 65535, 65535},
+        {202, 202, 202, 202, 202, 203, 65535, 65535, 65535, 65535, 65535},
+        {202, 202, 202, 202, 202, 202, 203, 65535, 65535, 65535, 65535},
+        {202, 202, 202, 202, 202, 202, 203, 65535, 65535, 65535, 65535},
+        {202, 202, 202, 202, 202, 202, 202, 203, 65535, 65535, 65535},
+        {202, 202, 202, 202, 202, 202, 202, 203, 65535, 65535, 65535},
+        {202, 202, 202, 202, 202, 202, 202, 202, 203, 65535, 65535},
+        {202, 202, 202, 202, 202, 202, 202, 202, 203, 65535, 65535},
+        {202, 202, 202, 202, 202, 202, 202, 202, 202, 203, 65535},
+        {202, 202, 202, 202, 202, 202, 202, 202, 202, 203, 65535},
+        {202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 203},
+        {202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 203},
+        {224, 222, 220, 218, 216, 214, 212, 210, 208, 206, 225},
+        {224, 222, 220, 218, 216, 214, 212, 210, 208, 206, 225},
+        {226, 223, 221, 219, 217, 215, 213, 211, 209, 207, 227},
+        {226, 223, 221, 219, 217, 215, 213, 211, 209, 207, 227},
+        {238, 237, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {238, 237, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {238, 238, 237, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {238, 238, 237, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {238, 238, 238, 237, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {238, 238, 238, 237, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {238, 238, 238, 238, 237, 65535, 65535, 65535, 65535, 65535, 65535},
+        {238, 238, 238, 238, 237, 65535, 65535, 65535, 65535, 65535, 65535},
+        {238, 238, 238, 238, 238, 237, 65535, 65535, 65535, 65535, 65535},
+        {238, 238, 238, 238, 238, 237, 65535, 65535, 65535, 65535, 65535},
+        {238, 238, 238, 238, 238, 238, 237, 65535, 65535, 65535, 65535},
+        {238, 238, 238, 238, 238, 238, 237, 65535, 65535, 65535, 65535},
+        {238, 238, 238, 238, 238, 238, 238, 237, 65535, 65535, 65535},
+        {238, 238, 238, 238, 238, 238, 238, 237, 65535, 65535, 65535},
+        {238, 238, 238, 238, 238, 238, 238, 238, 237, 65535, 65535},
+        {238, 238, 238, 238, 238, 238, 238, 238, 237, 65535, 65535},
+        {238, 238, 238, 238, 238, 238, 238, 238, 238, 237, 65535},
+        {238, 238, 238, 238, 238, 238, 238, 238, 238, 237, 65535},
+        {238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 237},
+        {237, 236, 235, 234, 233, 232, 231, 230, 229, 228, 237},
+        {238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 237},
+        {237, 236, 235, 234, 233, 232, 231, 230, 229, 228, 237},
+        {238, 238, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {238, 238, 238, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {238, 238, 238, 238, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+        {238, 238, 238, 238, 238, 65535, 65535, 65535, 65535, 65535, 65535},
+        {238, 238, 238, 238, 238, 238, 65535, 65535, 65535, 65535, 65535},
+        {238, 238, 238, 238, 238, 238, 238, 65535, 65535, 65535, 65535},
+        {238, 238, 238, 238, 238, 238, 238, 238, 65535, 65535, 65535},
+        {238, 238, 238, 238, 238, 238, 238, 238, 238, 65535, 65535},
+        {238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 65535},
+        {238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238},
+        {65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},
+    }};
+
+    static constexpr std::array<std::array<uint8_t, 11>, stateCount> points{{
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30},
+        {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30},
+        {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30},
+        {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30},
+        {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30},
+        {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30},
+        {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30},
+        {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30},
+        {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20},
+        {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 0, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 0, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0},
+        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    }};
+};
+
+#endif //BOWLINGSIMULATOR_GAMESTATETABLE_H
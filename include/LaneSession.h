@@ -0,0 +1,45 @@
+#ifndef BOWLINGSIMULATOR_LANESESSION_H
+#define BOWLINGSIMULATOR_LANESESSION_H
+
+#include "interface/ILaneListener.h"
+#include "interface/IPinSet.h"
+#include "FrameSet.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+// One to six bowlers sharing a pair of lanes. Each bowler bowls a whole frame, then
+// the next bowler up; after the last bowler the session moves to the next frame and
+// across to the other lane of the pair. The games are InlineFrameSets in one block
+// from the memory resource, so a pool can host thousands of sessions.
+class LaneSession {
+    std::pmr::vector<InlineFrameSet> games;
+    ILaneListener* listener;
+    uint8_t bowler = 0;
+    uint8_t ball = 0;
+    uint8_t startLane;
+
+public:
+    static constexpr std::size_t maxBowlers = 6;
+
+    explicit LaneSession(std::size_t bowlers, uint8_t startLane = 0, ILaneListener* listener = nullptr,
+                         std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    // The current bowler's next ball; pins are those left standing after it.
+    void Bowled(const IPinSet& pins);
+
+    bool Ended() const;
+
+    std::size_t Bowlers() const;
+
+    std::size_t CurrentBowler() const;
+
+    uint_fast8_t CurrentFrame() const;
+
+    uint_fast8_t CurrentLane() const;
+
+    const InlineFrameSet& Game(std::size_t bowler) const;
+};
+#endif //BOWLINGSIMULATOR_LANESESSION_H
@@ -0,0 +1,142 @@
+#ifndef BOWLINGSIMULATOR_LEAVECLASSIFIER_H
+#define BOWLINGSIMULATOR_LEAVECLASSIFIER_H
+
+#include "interface/IPinSet.h"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+enum class LeaveType : uint8_t {
+    NONE,
+    SINGLE_PIN,
+    MULTI_PIN,
+    SPLIT,
+    BABY_SPLIT,
+    WASHOUT
+};
+
+enum class NamedLeave : uint8_t {
+    NONE,
+    SEVEN_TEN,
+    FOUR_SIX,
+    BIG_FOUR,
+    GREEK_CHURCH
+};
+
+struct Leave {
+    LeaveType type = LeaveType::NONE;
+    NamedLeave name = NamedLeave::NONE;
+    uint8_t pinsUp = 0;
+
+    constexpr bool IsSplit() const {
+        return type == LeaveType::SPLIT || type == LeaveType::BABY_SPLIT;
+    }
+};
+
+// Masks use the PinSet layout: bit static_cast<int>(Pin::X) is set while pin X is standing.
+class LeaveClassifier {
+    static constexpr uint_fast16_t Bit(Pin p) {
+        return uint_fast16_t{1} << static_cast<uint8_t>(p);
+    }
+
+    // Pins touching each pin: the two diagonally behind/ahead of it, plus the
+    // "sleeper" directly behind (1-5, 2-8, 3-9). Row neighbours never touch.
+    static const std::array<uint_fast16_t, 10> neighbours;
+
+    static constexpr bool Connected(uint_fast16_t standing);
+    static constexpr NamedLeave Name(uint_fast16_t standing);
+    static constexpr Leave Build(uint_fast16_t standing);
+    static constexpr std::array<Leave, 1024> BuildTable();
+
+    static const std::array<Leave, 1024> table;
+
+public:
+    static constexpr uint_fast16_t allPins = 0b11'11'11'11'11;
+
+    static constexpr Leave Classify(uint_fast16_t standing);
+
+    static Leave Classify(const IPinSet& pins);
+
+    static void ClassifyAll(const uint16_t* standing, std::size_t count, Leave* out);
+
+    static std::array<std::size_t, 6> CountTypes(const uint16_t* standing, std::size_t count);
+};
+
+constexpr std::array<uint_fast16_t, 10> LeaveClassifier::neighbours{
+        Bit(Pin::TWO) | Bit(Pin::THREE) | Bit(Pin::FIVE),
+        Bit(Pin::ONE) | Bit(Pin::FOUR) | Bit(Pin::FIVE) | Bit(Pin::EIGHT),
+        Bit(Pin::ONE) | Bit(Pin::FIVE) | Bit(Pin::SIX) | Bit(Pin::NINE),
+        Bit(Pin::TWO) | Bit(Pin::SEVEN) | Bit(Pin::EIGHT),
+        Bit(Pin::ONE) | Bit(Pin::TWO) | Bit(Pin::THREE) | Bit(Pin::EIGHT) | Bit(Pin::NINE),
+        Bit(Pin::THREE) | Bit(Pin::NINE) | Bit(Pin::TEN),
+        Bit(Pin::FOUR),
+        Bit(Pin::TWO) | Bit(Pin::FOUR) | Bit(Pin::FIVE),
+        Bit(Pin::THREE) | Bit(Pin::FIVE) | Bit(Pin::SIX),
+        Bit(Pin::SIX)
+};
+
+constexpr bool LeaveClassifier::Connected(uint_fast16_t standing) {
+    uint_fast16_t reached = standing & -standing;
+    uint_fast16_t frontier = reached;
+    while (frontier) {
+        uint_fast16_t next = 0;
+        for (auto i = 0; i < 10; ++i)
+            if (frontier & (uint_fast16_t{1} << i))
+                next |= neighbours[i];
+        frontier = next & standing & ~reached;
+        reached |= frontier;
+    }
+    return reached == standing;
+}
+
+constexpr NamedLeave LeaveClassifier::Name(uint_fast16_t standing) {
+    switch (standing) {
+        case Bit(Pin::SEVEN) | Bit(Pin::TEN):
+            return NamedLeave::SEVEN_TEN;
+        case Bit(Pin::FOUR) | Bit(Pin::SIX):
+            return NamedLeave::FOUR_SIX;
+        case Bit(Pin::FOUR) | Bit(Pin::SIX) | Bit(Pin::SEVEN) | Bit(Pin::TEN):
+            return NamedLeave::BIG_FOUR;
+        case Bit(Pin::FOUR) | Bit(Pin::SIX) | Bit(Pin::SEVEN) | Bit(Pin::NINE) | Bit(Pin::TEN):
+        case Bit(Pin::FOUR) | Bit(Pin::SIX) | Bit(Pin::SEVEN) | Bit(Pin::EIGHT) | Bit(Pin::TEN):
+            return NamedLeave::GREEK_CHURCH;
+        default:
+            return NamedLeave::NONE;
+    }
+}
+
+constexpr Leave LeaveClassifier::Build(uint_fast16_t standing) {
+    Leave leave{};
+    leave.pinsUp = static_cast<uint8_t>(std::popcount(standing));
+    leave.name = Name(standing);
+    if (leave.pinsUp == 0)
+        leave.type = LeaveType::NONE;
+    else if (leave.pinsUp == 1)
+        leave.type = LeaveType::SINGLE_PIN;
+    else if (Connected(standing))
+        leave.type = LeaveType::MULTI_PIN;
+    else if (standing & Bit(Pin::ONE))
+        leave.type = LeaveType::WASHOUT;
+    else if (standing == (Bit(Pin::TWO) | Bit(Pin::SEVEN)) || standing == (Bit(Pin::THREE) | Bit(Pin::TEN)))
+        leave.type = LeaveType::BABY_SPLIT;
+    else
+        leave.type = LeaveType::SPLIT;
+    return leave;
+}
+
+constexpr std::array<Leave, 1024> LeaveClassifier::BuildTable() {
+    std::array<Leave, 1024> result{};
+    for (uint_fast16_t i = 0; i < result.size(); ++i)
+        result[i] = Build(i);
+    return result;
+}
+
+constexpr std::array<Leave, 1024> LeaveClassifier::table = LeaveClassifier::BuildTable();
+
+constexpr Leave LeaveClassifier::Classify(uint_fast16_t standing) {
+    return table[standing & allPins];
+}
+
+#endif //BOWLINGSIMULATOR_LEAVECLASSIFIER_H
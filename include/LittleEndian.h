@@ -0,0 +1,20 @@
+#ifndef BOWLINGSIMULATOR_LITTLEENDIAN_H
+#define BOWLINGSIMULATOR_LITTLEENDIAN_H
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+
+// Converts an integer between native and little endian, for the binary formats;
+// the same call goes either way.
+template <std::integral T>
+constexpr T LittleEndian(T value) {
+    if constexpr (std::endian::native == std::endian::big) {
+        T result = 0;
+        for (std::size_t i = 0; i < sizeof(T); ++i, value >>= 8)
+            result = static_cast<T>(result << 8 | (value & 0xFF));
+        return result;
+    }
+    return value;
+}
+#endif //BOWLINGSIMULATOR_LITTLEENDIAN_H
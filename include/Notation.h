@@ -0,0 +1,96 @@
+#ifndef BOWLINGSIMULATOR_NOTATION_H
+#define BOWLINGSIMULATOR_NOTATION_H
+
+#include "FrameSet.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class NotationException : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// A game read from standard notation. Notation only records pin counts, so each
+// ball knocks down the lowest numbered pins still standing; balls are the masks
+// left standing after each one, as in the archive.
+struct NotationGame {
+    std::array<uint16_t, 21> balls{};
+    uint8_t ballCount = 0;
+};
+
+// Standard notation: ten frames separated by whitespace, e.g. "X 9/ 8- -7 X X 45 F/ 9- XX7".
+// X is a strike, / a spare, - or F a miss (0 is accepted too) and 1-9 a count.
+class Notation {
+public:
+    enum class Symbol : uint8_t {
+        // 0-9 are pin counts.
+        STRIKE = 10,
+        SPARE,
+        SEPARATOR,
+        END_OF_LINE,
+        INVALID
+    };
+
+    // symbols[i] is the Symbol (or pin count) for text[i].
+    static void Classify(std::string_view text, std::span<uint8_t> symbols);
+
+    // Parses one complete, legal game.
+    static NotationGame Parse(std::string_view game);
+
+    // Parses one game already run through Classify; errors are reported at line.
+    static NotationGame Parse(std::span<const uint8_t> symbols, std::size_t line);
+
+    template <typename Frames>
+    static std::string Format(const BasicFrameSet<Frames>& frameSet);
+
+    // Appends one frame's balls; frame 9 is the tenth.
+    static void FormatFrame(uint_fast8_t frame, const FrameBallsVisitor::Balls& balls, std::string& out);
+};
+
+// Parses newline separated games from text arriving in chunks of any size. Blank
+// lines are skipped; a line ending in a chunk's middle is carried to the next one.
+// An illegal line throws NotationException from Feed or Finish. The stream then
+// resumes after that line: the games before it are in Games(), and the lines after
+// it are parsed by the next call.
+class NotationStream {
+    std::string carry;
+    std::vector<uint8_t> symbols;
+    std::vector<NotationGame> games;
+    std::size_t line = 1;
+
+    // Sets parsed to the end of the last line read, legal or not.
+    void ParseLines(std::string_view text, std::size_t& parsed);
+
+public:
+    // The games completed by this chunk, valid until the next call.
+    std::span<const NotationGame> Feed(std::string_view chunk);
+
+    // Parses a final line with no newline after it.
+    std::span<const NotationGame> Finish();
+
+    // The games completed by the last Feed or Finish, including one that threw.
+    std::span<const NotationGame> Games() const;
+};
+
+template <typename Frames>
+std::string Notation::Format(const BasicFrameSet<Frames>& frameSet) {
+    std::string out;
+    out.reserve(32);
+    for (uint_fast8_t i = 0; i < 10; ++i) {
+        const auto balls = frameSet.FrameBalls(i);
+        if (balls.count == 0)
+            break;
+        if (i)
+            out += ' ';
+        FormatFrame(i, balls, out);
+    }
+    return out;
+}
+#endif //BOWLINGSIMULATOR_NOTATION_H
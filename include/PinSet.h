@@ -1,30 +1,95 @@
 #ifndef BOWLINGSIMULATOR_PINSET_H
 #define BOWLINGSIMULATOR_PINSET_H
 
-#include <bitset>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <typeinfo>
 
 #include "interface/IPinSet.h"
+#include "ResourceAllocated.h"
+
+// Bit static_cast<int>(Pin::X) of the mask is set while pin X is standing. The
+// bulk operations work on arrays of such masks, one per rack; the single-rack
+// operations below are the same code applied to one mask.
+class PinSet final : public IPinSet, public ResourceAllocated {
+    static constexpr uint16_t fullRack = 0b11'11'11'11'11;
+
+    uint16_t pins = fullRack;
+
+    static constexpr uint16_t And(uint16_t rack, uint16_t ball) {
+        return rack & ball;
+    }
+
+    friend struct PinSetKernels;
 
-class PinSet : public IPinSet{
-    std::bitset<10> pins{0b11'11'11'11'11};
 public:
+    constexpr PinSet() = default;
+
+    constexpr explicit PinSet(uint_fast16_t standing) : pins{static_cast<uint16_t>(standing & fullRack)} {
+    }
+
+    // Spelled out: GCC 12 rejects a defaulted constexpr virtual destructor in
+    // constant evaluation ("used before its definition").
+    constexpr ~PinSet() override {
+    }
+
+    constexpr bool AllPinsUp() const override {
+        return pins == fullRack;
+    }
+
+    constexpr bool AllPinsDown() const override {
+        return pins == 0;
+    }
+
+    constexpr void KnockDownPin(Pin p) override {
+        pins &= ~(1u << static_cast<uint8_t>(p));
+    }
+
+    constexpr bool IsDown(Pin p) const override {
+        return !(pins & (1u << static_cast<uint8_t>(p)));
+    }
 
-    bool AllPinsUp() const override;
+    constexpr bool IsUp(Pin p) const override {
+        return !IsDown(p);
+    }
 
-    bool AllPinsDown() const override;
+    constexpr uint_fast8_t PinsUp() const override {
+        return std::popcount(pins);
+    }
 
-    void KnockDownPin(Pin p) override;
+    constexpr uint_fast8_t PinsDown() const override {
+        return 10 - std::popcount(pins);
+    }
 
-    bool IsDown(Pin p) const override;
+    constexpr void Reset() override {
+        pins = fullRack;
+    }
 
-    bool IsUp(Pin p) const override;
+    // Another PinSet is combined mask to mask; any other IPinSet is asked pin by pin.
+    constexpr IPinSet& operator&=(const IPinSet& rhs) override {
+        if (!std::is_constant_evaluated() && typeid(rhs) == typeid(PinSet)) {
+            pins = And(pins, static_cast<const PinSet&>(rhs).pins);
+            return *this;
+        }
+        for (auto i = 0; i < 10; ++i)
+            if (rhs.IsDown(static_cast<Pin>(i)))
+                pins = And(pins, static_cast<uint16_t>(~(1u << i)));
+        return *this;
+    }
 
-    uint_fast8_t PinsUp() const override;
+    constexpr uint_fast16_t Mask() const {
+        return pins;
+    }
 
-    uint_fast8_t PinsDown() const override;
+    // racks[i] &= balls[i] for every rack; balls may be shorter than racks.
+    static void AndAll(std::span<uint16_t> racks, std::span<const uint16_t> balls);
 
-    void Reset() override;
+    // counts[i] = pins standing in racks[i].
+    static void PopcountAll(std::span<const uint16_t> racks, std::span<uint8_t> counts);
 
-    IPinSet& operator&=(const IPinSet&) override;
+    static void ResetAll(std::span<uint16_t> racks);
 };
 #endif //BOWLINGSIMULATOR_PINSET_H
@@ -0,0 +1,70 @@
+#ifndef BOWLINGSIMULATOR_RAREEVENT_H
+#define BOWLINGSIMULATOR_RAREEVENT_H
+
+#include "BallModel.h"
+#include "SkillModel.h"
+
+#include <array>
+#include <cstdint>
+
+struct RareEventEstimate {
+    double probability = 0;
+    double standardError = 0;
+    // 95% confidence interval.
+    double low = 0;
+    double high = 0;
+    // Games played on InlineFrameSets, counting the part of a game a particle played.
+    double games = 0;
+    // Games plain Monte Carlo would need for the same standard error.
+    double naiveGames = 0;
+};
+
+enum class RareEventMethod : uint8_t {
+    // Balls clear the rack with strikeBias, and every series that gets there counts
+    // with the likelihood ratio of its balls.
+    IMPORTANCE_SAMPLING,
+    // Particles play frame by frame; those that can no longer reach the threshold
+    // are dropped and the survivors resampled back to full strength. The chance is
+    // the product of each frame's survival rate. Run as independent replications,
+    // whose spread gives the error.
+    SPLITTING
+};
+
+// The chance of a series of games reaching a total, such as a perfect game or an
+// 800 series, estimated without the astronomically many games plain Monte Carlo
+// would need. Both methods are unbiased.
+class RareEvent {
+public:
+    using Pinfall = BallModel::Pinfall;
+
+    struct Options {
+        RareEventMethod method = RareEventMethod::SPLITTING;
+        uint_fast8_t games = 1;
+        uint_fast16_t threshold = 300;
+        // Series for importance sampling; particles per replication for splitting.
+        uint64_t samples = 10'000;
+        uint64_t seed = 47;
+        // At or below the bowler's own rate the balls are not biased: plain Monte Carlo.
+        double strikeBias = 0.9;
+        uint_fast8_t replications = 20;
+    };
+
+private:
+    BallModel balls;
+
+    RareEventEstimate ImportanceSampling(const Options& options) const;
+
+    RareEventEstimate Splitting(const Options& options) const;
+
+public:
+    // Simulation's uniform balls: a number from 0 to 10, less the pins already down.
+    RareEvent();
+
+    // Counts as SkillModel::Pinfall gives them.
+    RareEvent(const SkillModel& model, const SkillRecord& bowler);
+
+    const Pinfall& Base(uint_fast8_t standing) const;
+
+    RareEventEstimate Estimate(const Options& options) const;
+};
+#endif //BOWLINGSIMULATOR_RAREEVENT_H
@@ -0,0 +1,110 @@
+#ifndef BOWLINGSIMULATOR_REPLAYLOG_H
+#define BOWLINGSIMULATOR_REPLAYLOG_H
+
+#include "FrameSet.h"
+#include "PinSet.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+class ReplayException : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// Replay log: this header, then one entry per ball, little endian. ball is the
+// PinSet mask passed to Bowled, with newGame set on a game's first ball; check is
+// the frame FrameSet moved on to after the ball, with the running score after the
+// ball shifted above it, so a replay stops on the first ball that scores differently.
+struct ReplayHeader {
+    static constexpr std::array<char, 8> expectedMagic{'B', 'W', 'L', 'R', 'P', 'L', 'Y', '1'};
+    static constexpr uint32_t currentVersion = 3;
+
+    std::array<char, 8> magic = expectedMagic;
+    uint32_t version = currentVersion;
+    uint32_t ruleVersion = 0;
+    uint64_t seed = 0;
+    uint64_t reserved = 0;
+};
+
+struct ReplayEntry {
+    static constexpr uint16_t newGame = 0x8000;
+
+    uint16_t ball = 0;
+    uint16_t check = 0;
+
+    // The score is at most 300, 9 bits, above the frame's 4.
+    static constexpr uint16_t Check(uint_fast8_t frame, uint_fast16_t score) {
+        return static_cast<uint16_t>(score << 4 | frame);
+    }
+};
+
+static_assert(sizeof(ReplayHeader) == 32);
+static_assert(sizeof(ReplayEntry) == 4);
+
+// Records each ball as it is bowled. Entries are buffered and written in blocks.
+// Nothing is hashed: on top of the scores a scoreboard reads anyway, a ball costs a
+// frame number and one store.
+class ReplayRecorder {
+    std::ostream& out;
+    std::vector<ReplayEntry> buffer;
+    ReplayEntry* next;
+    uint16_t nextFlags = ReplayEntry::newGame;
+
+public:
+    // Bump when a change to the frame rules changes any score.
+    static constexpr uint32_t ruleVersion = 1;
+    static constexpr std::size_t bufferEntries = 16'384;
+
+    ReplayRecorder(std::ostream& out, uint64_t seed);
+    ReplayRecorder(const ReplayRecorder&) = delete;
+    ReplayRecorder& operator=(const ReplayRecorder&) = delete;
+    ~ReplayRecorder();
+
+    // The next ball starts a new game.
+    void StartGame() {
+        nextFlags = ReplayEntry::newGame;
+    }
+
+    // Bowls the ball into the game and logs it; returns the running score.
+    template <typename Frames>
+    uint_fast16_t Bowled(BasicFrameSet<Frames>& frameSet, const PinSet& ball);
+
+    void Flush();
+};
+
+struct ReplayResult {
+    uint64_t seed = 0;
+    uint64_t balls = 0;
+    uint64_t games = 0;
+    bool diverged = false;
+    // Where the first divergence is: the ball's index in the log and its game.
+    uint64_t divergedBall = 0;
+    uint64_t divergedGame = 0;
+    uint16_t expected = 0;
+    uint16_t actual = 0;
+};
+
+class ReplayLog {
+public:
+    // Replays the log through InlineFrameSet, verifying every check, and stops at the
+    // first that does not match.
+    static ReplayResult Replay(std::istream& in);
+};
+
+template <typename Frames>
+uint_fast16_t ReplayRecorder::Bowled(BasicFrameSet<Frames>& frameSet, const PinSet& ball) {
+    frameSet.Bowled(ball);
+    const auto score = frameSet.FrameScores().back();
+    *next++ = {static_cast<uint16_t>(ball.Mask() | nextFlags), ReplayEntry::Check(frameSet.CurrentFrame(), score)};
+    nextFlags = 0;
+    if (next == buffer.data() + bufferEntries)
+        Flush();
+    return score;
+}
+#endif //BOWLINGSIMULATOR_REPLAYLOG_H
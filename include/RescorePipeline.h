@@ -0,0 +1,57 @@
+#ifndef BOWLINGSIMULATOR_RESCOREPIPELINE_H
+#define BOWLINGSIMULATOR_RESCOREPIPELINE_H
+
+#include "Archive.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+
+enum class RescoreEngine {
+    FRAMESET,
+    BATCH
+};
+
+struct RescoreProgress {
+    std::size_t records = 0;
+    std::size_t totalRecords = 0;
+    std::size_t changed = 0;
+    std::size_t invalid = 0;
+    double seconds = 0;
+
+    double RecordsPerSecond() const;
+
+    double BytesPerSecond() const;
+};
+
+// Rescores an archive through five stages joined by bounded queues: a reader that
+// slices the mapped archive into chunks, then decode, score and diff pools, then a
+// writer that puts chunks back in order. The reader only starts a chunk once fewer
+// than maxChunksInFlight are unwritten, so a slow writer throttles everything.
+class RescorePipeline {
+public:
+    struct Options {
+        RescoreEngine engine = RescoreEngine::BATCH;
+        std::size_t chunkRecords = 4096;
+        std::size_t queueCapacity = 8;
+        std::size_t maxChunksInFlight = 64;
+        unsigned decodeThreads = 1;
+        unsigned scoreThreads = 1;
+        unsigned diffThreads = 1;
+        std::chrono::milliseconds progressInterval{1000};
+        std::function<void(const RescoreProgress&)> progress;
+    };
+
+    explicit RescorePipeline(Options options);
+
+    // Writes every record to the output with its recomputed score. Changed games go
+    // to diff as "gameId,bowlerId,storedScore,newScore" lines; games whose balls do
+    // not make exactly one complete game are copied unchanged and counted as invalid.
+    RescoreProgress Run(const ArchiveReader& input, ArchiveWriter& output, std::ostream* diff = nullptr);
+
+private:
+    Options options;
+};
+#endif //BOWLINGSIMULATOR_RESCOREPIPELINE_H
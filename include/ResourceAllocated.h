@@ -0,0 +1,37 @@
+#ifndef BOWLINGSIMULATOR_RESOURCEALLOCATED_H
+#define BOWLINGSIMULATOR_RESOURCEALLOCATED_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+
+// Base for engine objects that can live in a std::pmr::memory_resource. The owning
+// resource and block size are kept in a header in front of each object, so deleting
+// through a std::unique_ptr to an interface hands the memory back to where it came from.
+class ResourceAllocated {
+    struct Header {
+        std::pmr::memory_resource* resource;
+        std::size_t size;
+    };
+
+    static void Deallocate(void* p);
+
+public:
+    static constexpr std::size_t headerSize = alignof(std::max_align_t);
+
+    static constexpr std::size_t AllocationSize(std::size_t size) {
+        return headerSize + (size + headerSize - 1) / headerSize * headerSize;
+    }
+
+    static void* operator new(std::size_t size);
+    static void* operator new(std::size_t size, std::pmr::memory_resource* resource);
+    // constexpr only so derived classes can have constexpr virtual destructors;
+    // nothing is ever deleted during constant evaluation.
+    static constexpr void operator delete(void* p) {
+        if (!std::is_constant_evaluated())
+            Deallocate(p);
+    }
+
+    static void operator delete(void* p, std::pmr::memory_resource* resource);
+};
+#endif //BOWLINGSIMULATOR_RESOURCEALLOCATED_H
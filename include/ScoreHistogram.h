@@ -0,0 +1,141 @@
+#ifndef BOWLINGSIMULATOR_SCOREHISTOGRAM_H
+#define BOWLINGSIMULATOR_SCOREHISTOGRAM_H
+
+#include "FrameSet.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <stdexcept>
+#include <vector>
+
+class ScoreHistogramException : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// Counts of games by score, 0 to 300. Each histogram starts on its own cache line
+// and is padded to a whole number of them, so two threads never share a line.
+struct alignas(64) Histogram {
+    static constexpr std::size_t bins = 301;
+
+    std::array<uint64_t, bins> counts{};
+
+    // Throws std::out_of_range past 300.
+    void Add(uint_fast16_t score) {
+        if (score >= bins)
+            throw std::out_of_range{"A score cannot be over 300"};
+        ++counts[score];
+    }
+
+    void Merge(const Histogram& other);
+
+    uint64_t Total() const;
+
+    double Mean() const;
+
+    // Nearest rank: the smallest score that at least a fraction p of games are at
+    // or below. Throws std::invalid_argument outside 0 to 1; 0 when empty.
+    uint_fast16_t Percentile(double p) const;
+};
+
+// Binary file: this header, the game histogram, the frame histograms if there are
+// any, then one histogram per bowler. Each is bins little endian uint64 counts.
+struct ScoreHistogramHeader {
+    static constexpr std::array<char, 8> expectedMagic{'B', 'W', 'L', 'H', 'I', 'S', 'T', '1'};
+    static constexpr uint32_t currentVersion = 1;
+
+    std::array<char, 8> magic = expectedMagic;
+    uint32_t version = currentVersion;
+    uint16_t bins = Histogram::bins;
+    uint16_t frames = 0;
+    uint32_t bowlers = 0;
+    uint32_t reserved = 0;
+    uint64_t reserved2 = 0;
+};
+
+static_assert(sizeof(ScoreHistogramHeader) == 32);
+
+// Final scores of many games, optionally also the running score after each frame
+// and the final score per bowler. Bowlers are numbered from 0.
+class ScoreHistogram {
+public:
+    struct Options {
+        bool perFrame = false;
+        uint32_t bowlers = 0;
+    };
+
+private:
+    Histogram games;
+    std::vector<Histogram> frames;
+    std::vector<Histogram> bowlers;
+
+public:
+    ScoreHistogram() = default;
+
+    explicit ScoreHistogram(Options options);
+
+    // A bowler past Bowlers() only counts towards the game histogram. Throws
+    // std::out_of_range for a score over 300.
+    void Add(uint_fast16_t score, uint32_t bowler = 0);
+
+    // A finished game: its score, each frame's running score and the bowler's score.
+    // Reads FrameScores(), so no other thread may be reading the same game.
+    template <typename Frames>
+    void Add(const BasicFrameSet<Frames>& frameSet, uint32_t bowler = 0);
+
+    void Merge(const ScoreHistogram& other);
+
+    void Clear();
+
+    const Histogram& Games() const;
+
+    bool PerFrame() const;
+
+    // Running score after frame (0 to 9). Throws std::out_of_range without frames.
+    const Histogram& Frame(uint_fast8_t frame) const;
+
+    uint32_t Bowlers() const;
+
+    const Histogram& Bowler(uint32_t bowler) const;
+
+    // One row per score: score,games, then frame1..frame10 and bowler0.. columns.
+    void WriteCsv(std::ostream& out) const;
+
+    void Save(std::ostream& out) const;
+
+    // Throws ScoreHistogramException on a bad header, or a stream shorter than the
+    // histograms its header promises.
+    static ScoreHistogram Load(std::istream& in);
+};
+
+template <typename Frames>
+void ScoreHistogram::Add(const BasicFrameSet<Frames>& frameSet, uint32_t bowler) {
+    const auto& scores = frameSet.FrameScores();
+    games.Add(scores.back());
+    if (!frames.empty())
+        for (std::size_t i = 0; i < scores.size(); ++i)
+            frames[i].Add(scores[i]);
+    if (bowler < bowlers.size())
+        bowlers[bowler].Add(scores.back());
+}
+
+// One ScoreHistogram per thread, merged once the threads are done. A thread only
+// ever touches its own shard, so adding a game is a plain increment.
+class ScoreCollector {
+    ScoreHistogram::Options options;
+    std::vector<ScoreHistogram> shards;
+
+public:
+    ScoreCollector(unsigned threads, ScoreHistogram::Options options = {});
+
+    unsigned Threads() const;
+
+    ScoreHistogram& Shard(unsigned thread);
+
+    ScoreHistogram Merge() const;
+
+    void Clear();
+};
+#endif //BOWLINGSIMULATOR_SCOREHISTOGRAM_H
@@ -0,0 +1,95 @@
+#ifndef BOWLINGSIMULATOR_SHARDCOORDINATOR_H
+#define BOWLINGSIMULATOR_SHARDCOORDINATOR_H
+
+#include "ScoreHistogram.h"
+#include "Simulation.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+class ShardCoordinatorException : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// What a shard has played after its first chunks chunks.
+struct alignas(64) ShardCheckpoint {
+    uint64_t chunks = 0;
+    SimulationTotals totals;
+    Histogram histogram;
+};
+
+// A shard's shared memory segment. The worker writes the next checkpoint into the
+// copy not in use and only then bumps committed, so a worker killed at any point
+// leaves the last whole checkpoint behind.
+struct ShardSlot {
+    std::atomic<uint64_t> committed{0};
+    ShardCheckpoint checkpoints[2];
+
+    const ShardCheckpoint& Committed() const {
+        return checkpoints[committed.load(std::memory_order_acquire) % 2];
+    }
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "ShardSlot is shared between processes");
+
+struct ShardReport {
+    uint64_t firstChunk = 0;
+    uint64_t chunks = 0;
+    // Workers that had to be forked again after one died.
+    unsigned restarts = 0;
+};
+
+struct ShardResults {
+    SimulationTotals totals;
+    Histogram histogram;
+    std::vector<ShardReport> shards;
+
+    unsigned Restarts() const;
+};
+
+// Plays games in forked worker processes on this machine. The games are cut into
+// chunks, each seeded from its own index, and every worker plays a contiguous run
+// of them. The results therefore do not depend on the number of workers, nor on
+// how often a worker crashed and was resumed from its last checkpoint.
+class ShardCoordinator {
+public:
+    struct Options {
+        unsigned workers = 4;
+        uint64_t games = 1'000'000;
+        // Games between checkpoints: what a crash can lose.
+        uint64_t chunkGames = 10'000;
+        uint64_t seed = 48;
+        SimulationEngine engine = SimulationEngine::INLINE;
+        // Per shard, before Run gives up.
+        unsigned maxRestarts = 3;
+    };
+
+    // Called in the worker before each chunk; attempt counts the worker's restarts.
+    using ChunkHook = std::function<void(unsigned shard, uint64_t chunk, unsigned attempt)>;
+
+private:
+    const Simulation& simulation;
+    Options options;
+    ChunkHook hook;
+
+    void Work(ShardSlot& slot, unsigned shard, const ShardReport& report, unsigned attempt) const;
+
+public:
+    ShardCoordinator(const Simulation& simulation, Options options, ChunkHook hook = {});
+
+    uint64_t Chunks() const;
+
+    // The generator a chunk is played from. Both the seed and the chunk go through a
+    // seed_seq, so runs whose seeds differ by a few do not share chunks.
+    static std::mt19937_64 ChunkRng(uint64_t seed, uint64_t chunk);
+
+    // Throws ShardCoordinatorException when a fork fails or a shard keeps dying.
+    ShardResults Run() const;
+};
+#endif //BOWLINGSIMULATOR_SHARDCOORDINATOR_H
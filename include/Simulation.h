@@ -0,0 +1,121 @@
+#ifndef BOWLINGSIMULATOR_SIMULATION_H
+#define BOWLINGSIMULATOR_SIMULATION_H
+
+#include "FrameSet.h"
+#include "GameArena.h"
+#include "PinSet.h"
+#include "SkillModel.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+
+struct SimulationTotals {
+    uint64_t games = 0;
+    uint64_t total = 0;
+    uint_fast16_t best = 0;
+
+    void Add(uint_fast16_t score) {
+        ++games;
+        total += score;
+        best = std::max(best, score);
+    }
+
+    void Merge(const SimulationTotals& other);
+
+    double Average() const;
+};
+
+// Where a game's frames live: FrameSet on the global heap, FrameSet on a GameArena
+// rewound after every game, or InlineFrameSet with no allocation at all.
+enum class SimulationEngine : uint8_t {
+    HEAP,
+    ARENA,
+    INLINE
+};
+
+// The simulated game loop: balls are uniform pinfalls, or sampled from a bowler's
+// fitted skill when there is a model. One Simulation can be shared by many threads
+// as long as each brings its own rng.
+class Simulation {
+    const SkillModel* model;
+    SkillRecord bowler;
+
+    template <typename Frames>
+    void PlayGame(BasicFrameSet<Frames>& frameSet, std::mt19937_64& rng) const;
+
+public:
+    explicit Simulation(const SkillModel* model = nullptr, uint32_t bowlerId = 0);
+
+    static const char* Name(SimulationEngine engine);
+
+    // Knocks down the first pinsDown pins, 0 to 10 at random.
+    static PinSet RandomBall(std::mt19937_64& rng, uint_fast64_t& pinsDown);
+
+    // Bowls the game to its end, one ball(standing) at a time: ball is given the
+    // mask of pins standing and returns the mask the ball leaves. The rack is full
+    // again after a strike, a spare or the end of a frame.
+    template <typename Frames, typename Ball>
+    static void PlayRacks(BasicFrameSet<Frames>& frameSet, Ball&& ball);
+
+    // Hands every finished game's score to sink.
+    template <typename Sink>
+    void Play(SimulationEngine engine, uint_fast64_t games, std::mt19937_64& rng, Sink&& sink) const;
+
+    SimulationTotals Play(SimulationEngine engine, uint_fast64_t games, std::mt19937_64& rng) const;
+};
+
+template <typename Frames, typename Ball>
+void Simulation::PlayRacks(BasicFrameSet<Frames>& frameSet, Ball&& ball) {
+    uint16_t standing = SkillModel::fullRack;
+    while (!frameSet.Ended()) {
+        const auto frame = frameSet.CurrentFrame();
+        const uint16_t after = ball(standing);
+        frameSet.Bowled(PinSet{after});
+        standing = after == 0 || frameSet.CurrentFrame() != frame ? SkillModel::fullRack : after;
+    }
+}
+
+template <typename Frames>
+void Simulation::PlayGame(BasicFrameSet<Frames>& frameSet, std::mt19937_64& rng) const {
+    if (model) {
+        PlayRacks(frameSet, [&](uint16_t standing) { return model->Sample(bowler, standing, rng); });
+        return;
+    }
+    uint_fast64_t pinsDown = 0;
+    while (!frameSet.Ended())
+        frameSet.Bowled(RandomBall(rng, pinsDown));
+}
+
+template <typename Sink>
+void Simulation::Play(SimulationEngine engine, uint_fast64_t games, std::mt19937_64& rng, Sink&& sink) const {
+    switch (engine) {
+        case SimulationEngine::HEAP:
+            for (uint_fast64_t i = 0; i < games; ++i) {
+                FrameSet frameSet{};
+                PlayGame(frameSet, rng);
+                sink(frameSet.FrameScores().back());
+            }
+            break;
+        case SimulationEngine::ARENA: {
+            GameArena arena{1};
+            for (uint_fast64_t i = 0; i < games; ++i) {
+                {
+                    FrameSet frameSet{arena.Resource()};
+                    PlayGame(frameSet, rng);
+                    sink(frameSet.FrameScores().back());
+                }
+                arena.Reset();
+            }
+            break;
+        }
+        case SimulationEngine::INLINE:
+            for (uint_fast64_t i = 0; i < games; ++i) {
+                InlineFrameSet frameSet{};
+                PlayGame(frameSet, rng);
+                sink(frameSet.FrameScores().back());
+            }
+            break;
+    }
+}
+#endif //BOWLINGSIMULATOR_SIMULATION_H
@@ -0,0 +1,124 @@
+#ifndef BOWLINGSIMULATOR_SKILLMODEL_H
+#define BOWLINGSIMULATOR_SKILLMODEL_H
+
+#include "Archive.h"
+#include "LeaveClassifier.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+class SkillModelException : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// One bowler's fitted skill. Probabilities are fixed point out of 65536: firstBall
+// is cumulative over pins knocked down by a first ball, conversion is the chance of
+// clearing each LeaveType, and pinHit the chance each pin of a missed leave falls.
+struct SkillRecord {
+    static constexpr uint32_t pooledId = 0xFFFF'FFFF;
+
+    uint32_t bowlerId = 0;
+    uint32_t games = 0;
+    std::array<uint16_t, 11> firstBall{};
+    std::array<uint16_t, 6> conversion{};
+    uint16_t pinHit = 0;
+    std::array<uint16_t, 2> reserved{};
+};
+
+// Model file: this header, the pooled first-ball leave counts (which pins are left
+// standing, for each number knocked down), the pooled record, then one record per
+// bowler sorted by id. Little endian.
+struct SkillModelHeader {
+    static constexpr std::array<char, 8> expectedMagic{'B', 'W', 'L', 'S', 'K', 'I', 'L', '1'};
+    static constexpr uint32_t currentVersion = 1;
+
+    std::array<char, 8> magic = expectedMagic;
+    uint32_t version = currentVersion;
+    uint32_t recordSize = sizeof(SkillRecord);
+    uint32_t bowlerCount = 0;
+    uint32_t reserved = 0;
+    uint64_t gamesFitted = 0;
+};
+
+static_assert(sizeof(SkillRecord) == 48);
+static_assert(sizeof(SkillModelHeader) == 32);
+
+// Per-bowler first-ball and spare-conversion statistics fitted from an archive,
+// sampled ball by ball in place of a uniform pinfall.
+class SkillModel {
+    struct Leave {
+        uint16_t standing = 0;
+        uint64_t cumulative = 0;
+    };
+
+    SkillModelHeader header;
+    std::array<uint32_t, 1024> leaveCounts{};
+    SkillRecord pooled;
+    std::vector<SkillRecord> bowlers;
+    // Leaves with the same number of pins down, cumulative within the group.
+    std::array<std::vector<Leave>, 11> leaves;
+
+    void BuildLeaves();
+    uint16_t SampleLeave(uint_fast8_t pinsDown, uint32_t random) const;
+
+public:
+    static constexpr uint16_t fullRack = 0b11'11'11'11'11;
+
+    // Games that are not complete and legal are skipped.
+    static SkillModel Fit(std::span<const ArchiveRecord> records,
+                          unsigned threads = std::thread::hardware_concurrency());
+
+    static SkillModel Load(const std::string& path);
+
+    void Save(const std::string& path) const;
+
+    uint64_t GamesFitted() const;
+
+    std::span<const SkillRecord> Bowlers() const;
+
+    const SkillRecord& Pooled() const;
+
+    // The bowler's record, or the pooled one for a bowler the archive never saw.
+    const SkillRecord& Find(uint32_t bowlerId) const;
+
+    // What Sample does at a rack of standing pins, seen as counts: element k is the
+    // chance the next ball knocks down k pins. Which pins stand is averaged over the
+    // pooled leaves with that many up.
+    std::array<double, 11> Pinfall(const SkillRecord& bowler, uint_fast8_t standing) const;
+
+    // The pins left standing after the bowler's next ball at a rack of standing pins. A
+    // full rack is sampled as a first ball, even after a gutter ball.
+    template <typename Rng>
+    uint16_t Sample(const SkillRecord& bowler, uint_fast16_t standing, Rng& rng) const;
+};
+
+template <typename Rng>
+uint16_t SkillModel::Sample(const SkillRecord& bowler, uint_fast16_t standing, Rng& rng) const {
+    static_assert(Rng::max() - Rng::min() == UINT64_MAX, "Sample takes 64 random bits per draw");
+    const uint64_t random = rng();
+    if (standing == fullRack) {
+        const auto r = static_cast<uint16_t>(random);
+        uint_fast8_t pinsDown = 0;
+        while (pinsDown < 10 && r >= bowler.firstBall[pinsDown])
+            ++pinsDown;
+        return SampleLeave(pinsDown, static_cast<uint32_t>(random >> 32));
+    }
+    const auto type = static_cast<std::size_t>(LeaveClassifier::Classify(standing).type);
+    if (static_cast<uint16_t>(random) < bowler.conversion[type])
+        return 0;
+    // A miss: each pin falls on its own, but at least one stays up.
+    uint64_t bits = rng();
+    uint16_t after = 0;
+    for (auto pin = 0; pin < 10; ++pin, bits >>= 6)
+        if ((standing & (1u << pin)) && ((bits & 0x3F) << 10) >= bowler.pinHit)
+            after |= 1u << pin;
+    return after ? after : static_cast<uint16_t>(standing & -standing);
+}
+#endif //BOWLINGSIMULATOR_SKILLMODEL_H
@@ -0,0 +1,54 @@
+#ifndef BOWLINGSIMULATOR_SPARESOLVER_H
+#define BOWLINGSIMULATOR_SPARESOLVER_H
+
+#include "interface/IAccuracyModel.h"
+
+#include <array>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Expectimax over (frame, ball, standing pins, bonus state). Pending bonuses are
+// tracked per ball rather than as a single count: bonusNext is how many earlier
+// frames also score the next ball, bonusAfter how many score the one after it.
+class SpareSolver {
+public:
+    struct State {
+        uint_fast8_t frame = 0;
+        uint_fast8_t ball = 0;
+        uint_fast16_t standing = 0b11'11'11'11'11;
+        uint_fast8_t bonusNext = 0;
+        uint_fast8_t bonusAfter = 0;
+        bool struck = false;
+    };
+
+private:
+    static constexpr std::size_t bonusStates = 12;
+    static constexpr std::size_t masks = 1024;
+    static constexpr std::size_t tableSize = 10 * 3 * bonusStates * masks;
+
+    std::array<IAccuracyModel::Outcomes_t, masks * 10> outcomes;
+    std::vector<double> values;
+    std::vector<uint8_t> policy;
+
+    static std::size_t Index(const State& state);
+    static State Next(const State& state, uint_fast16_t after, bool& ended);
+
+    template <typename F>
+    static void ParallelFor(std::size_t count, unsigned threads, F&& fn);
+
+    double Value(const State& state) const;
+    void SolveState(const State& state);
+
+public:
+    SpareSolver(const IAccuracyModel& model);
+
+    void Solve(unsigned threads = std::thread::hardware_concurrency());
+
+    double ExpectedScore() const;
+
+    double ExpectedScore(const State& state) const;
+
+    Pin BestTarget(const State& state) const;
+};
+#endif //BOWLINGSIMULATOR_SPARESOLVER_H
@@ -0,0 +1,119 @@
+#ifndef BOWLINGSIMULATOR_SWEEP_H
+#define BOWLINGSIMULATOR_SWEEP_H
+
+#include "BallModel.h"
+#include "GameStateSpace.h"
+#include "SkillModel.h"
+
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+class SweepException : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+enum class SweepMethod : uint8_t {
+    // The final score distribution, worked out backwards over the GameStateSpace.
+    EXACT,
+    // Games played ball by ball through the GameStateSpace.
+    SIMULATION
+};
+
+// A change to the bowler and the rules. The deltas are added to the chance of
+// clearing a full rack (a strike) and a partial one (a spare); the other counts
+// keep their proportions.
+struct SweepPoint {
+    double strikeDelta = 0;
+    double spareDelta = 0;
+    GameRules rules;
+};
+
+// Every combination of the values, strike deltas outermost.
+struct SweepGrid {
+    std::vector<double> strikeDeltas{0};
+    std::vector<double> spareDeltas{0};
+    std::vector<bool> tenthFrameBonus{true};
+
+    std::vector<SweepPoint> Points() const;
+};
+
+struct SweepResult {
+    SweepPoint point;
+    // The hash the result is cached under; see Sweep::Key.
+    uint64_t key = 0;
+    double mean = 0;
+    double standardDeviation = 0;
+    uint_fast16_t median = 0;
+    uint_fast16_t percentile99 = 0;
+    double atLeast200 = 0;
+    // Found in the cache rather than worked out.
+    bool cached = false;
+};
+
+// Results by key, kept between sweeps in a CSV file so a repeated or extended sweep
+// only works out the points it has not seen.
+class SweepCache {
+    std::map<uint64_t, SweepResult> results;
+
+public:
+    // A missing file is an empty cache. Throws SweepException on a malformed line.
+    static SweepCache Load(const std::string& path);
+
+    void Save(const std::string& path) const;
+
+    std::size_t Size() const;
+
+    const SweepResult* Find(uint64_t key) const;
+
+    void Insert(const SweepResult& result);
+};
+
+// Runs a grid of what-ifs against one bowler: Simulation's uniform balls, or a
+// fitted bowler's SkillModel::Pinfall. Points are shared out between threads.
+class Sweep {
+public:
+    using Distribution = BallModel::Distribution;
+
+    struct Options {
+        SweepMethod method = SweepMethod::EXACT;
+        // Per point, for SIMULATION.
+        uint64_t games = 100'000;
+        uint64_t seed = 49;
+        unsigned threads = std::thread::hardware_concurrency();
+    };
+
+private:
+    BallModel base;
+
+    BallModel Adjusted(const SweepPoint& point) const;
+
+    Distribution Simulated(const GameStateSpace& space, const BallModel& balls, const Options& options) const;
+
+    SweepResult Evaluate(const SweepPoint& point, const GameStateSpace& space, const Options& options) const;
+
+public:
+    Sweep();
+
+    Sweep(const SkillModel& model, const SkillRecord& bowler);
+
+    // A hash of the bowler, the point and the method, and for SIMULATION the games
+    // and seed: whatever changes the result.
+    uint64_t Key(const SweepPoint& point, const Options& options) const;
+
+    SweepResult Evaluate(const SweepPoint& point, const Options& options) const;
+
+    // Results in grid order. Points found in the cache are not worked out again;
+    // the rest are added to it.
+    std::vector<SweepResult> Run(const SweepGrid& grid, const Options& options, SweepCache* cache = nullptr) const;
+
+    // One row per result.
+    static void WriteTable(std::ostream& out, const std::vector<SweepResult>& results);
+};
+#endif //BOWLINGSIMULATOR_SWEEP_H
@@ -0,0 +1,71 @@
+#ifndef BOWLINGSIMULATOR_WINPROBABILITY_H
+#define BOWLINGSIMULATOR_WINPROBABILITY_H
+
+#include "BallModel.h"
+#include "FrameSet.h"
+#include "GameStateTable.h"
+#include "SkillModel.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Head-to-head odds for two bowlers part way through their games. For every state
+// of GameStateTable (frame, ball, pins standing and bonuses owed) each bowler's
+// distribution of points still to come is worked out once, backwards from the end
+// of the game, so an update after a ball is a table step and the odds are one
+// pass over two 301-bin distributions.
+class WinProbability {
+public:
+    static constexpr std::size_t maxPoints = 300;
+
+    using Distribution = BallModel::Distribution;
+
+    struct Odds {
+        double first = 0;
+        double second = 0;
+        double tie = 0;
+    };
+
+private:
+    struct Player {
+        std::vector<Distribution> remaining;
+        uint16_t state = GameStateTable::start;
+        uint_fast16_t score = 0;
+    };
+
+    std::array<Player, 2> players;
+
+public:
+    WinProbability(const SkillModel& model, const SkillRecord& first, const SkillRecord& second);
+
+    // Both games back to the first ball.
+    void Reset();
+
+    // player (0 or 1) bowled a ball that knocked down pins.
+    void Bowled(std::size_t player, uint_fast8_t pins);
+
+    // Replays a player's game so far from a FrameSet.
+    template <typename Frames>
+    void Sync(std::size_t player, const BasicFrameSet<Frames>& frameSet);
+
+    uint_fast16_t Score(std::size_t player) const;
+
+    // Distribution of the player's final score.
+    Distribution FinalScore(std::size_t player) const;
+
+    Odds Current() const;
+};
+
+template <typename Frames>
+void WinProbability::Sync(std::size_t player, const BasicFrameSet<Frames>& frameSet) {
+    players[player].state = GameStateTable::start;
+    players[player].score = 0;
+    for (uint_fast8_t frame = 0; frame < 10; ++frame) {
+        const auto balls = frameSet.FrameBalls(frame);
+        for (auto i = 0; i < balls.count; ++i)
+            Bowled(player, balls.pins[i]);
+    }
+}
+#endif //BOWLINGSIMULATOR_WINPROBABILITY_H
@@ -0,0 +1,21 @@
+#ifndef BOWLINGSIMULATOR_IACCURACYMODEL_H
+#define BOWLINGSIMULATOR_IACCURACYMODEL_H
+
+#include "interface/IPinSet.h"
+
+#include <cstdint>
+#include <vector>
+
+class IAccuracyModel {
+public:
+    struct Outcome {
+        uint16_t standing = 0;
+        double probability = 0;
+    };
+    using Outcomes_t = std::vector<Outcome>;
+
+    virtual Outcomes_t Outcomes(uint_fast16_t standing, Pin target) const = 0;
+
+    virtual ~IAccuracyModel() = default;
+};
+#endif //BOWLINGSIMULATOR_IACCURACYMODEL_H
@@ -3,6 +3,7 @@
 
 #include "interface/IPinSet.h"
 
+#include <array>
 #include <cstdint>
 #include <stdexcept>
 #include <variant>
@@ -19,7 +20,16 @@ public:
     struct Spare{uint_fast8_t first = 0;};
     struct SpareWithBonus{uint_fast8_t first = 0; uint_fast8_t bonus = 0; };
     struct Open{uint_fast8_t total = 0; uint_fast8_t first = 0; uint_fast8_t second = 0;};
-    using Score_t = std::variant<Open, Strike, Spare, SpareWithBonus, ThreeStrikes>;
+    struct StrikeWithBonus{uint_fast8_t second = 0; uint_fast8_t bonus = 0; };
+    using Score_t = std::variant<Open, Strike, Spare, SpareWithBonus, ThreeStrikes, StrikeWithBonus>;
+
+    // The pins each ball of a frame knocked down and their sum; count is how many
+    // balls have been bowled in it.
+    struct Balls {
+        uint_fast8_t total = 0;
+        std::array<uint_fast8_t, 3> pins{};
+        uint_fast8_t count = 0;
+    };
 
     virtual void Bowled(const IPinSet& newPins) = 0;
 
@@ -0,0 +1,32 @@
+#ifndef BOWLINGSIMULATOR_ILANELISTENER_H
+#define BOWLINGSIMULATOR_ILANELISTENER_H
+
+#include <cstdint>
+
+class ILaneListener {
+public:
+    struct BallEvent {
+        uint8_t bowler = 0;
+        uint8_t frame = 0;
+        uint8_t ball = 0;
+        uint8_t lane = 0;
+        // The ball's mask as passed to LaneSession::Bowled.
+        uint16_t standing = 0;
+        uint16_t score = 0;
+    };
+
+    struct FrameEvent {
+        uint8_t bowler = 0;
+        uint8_t frame = 0;
+        uint8_t lane = 0;
+        uint16_t score = 0;
+        bool gameEnded = false;
+    };
+
+    virtual void BallBowled(const BallEvent& event) = 0;
+
+    virtual void FrameEnded(const FrameEvent& event) = 0;
+
+    virtual ~ILaneListener() = default;
+};
+#endif //BOWLINGSIMULATOR_ILANELISTENER_H
@@ -0,0 +1,47 @@
+#include "AccuracyModel.h"
+
+#include <array>
+
+static constexpr std::array<uint_fast16_t, 10> behind{
+        0b00'00'00'01'10,
+        0b00'00'01'10'00,
+        0b00'00'11'00'00,
+        0b00'11'00'00'00,
+        0b01'10'00'00'00,
+        0b11'00'00'00'00,
+        0, 0, 0, 0
+};
+static constexpr std::array<int, 10> leftOf{-1, -1, 1, -1, 3, 4, -1, 6, 7, 8};
+static constexpr std::array<int, 10> rightOf{-1, 2, -1, 4, 5, -1, 7, 8, 9, -1};
+
+AccuracyModel::AccuracyModel(double accuracy) : accuracy{accuracy} {
+}
+
+uint_fast16_t AccuracyModel::Cascade(uint_fast16_t standing, int pin) {
+    if (pin < 0 || !(standing & (uint_fast16_t{1} << pin)))
+        return standing;
+    standing &= ~(uint_fast16_t{1} << pin);
+    for (auto i = pin + 1; i < 10; ++i)
+        if (behind[pin] & (uint_fast16_t{1} << i))
+            standing = Cascade(standing, i);
+    return standing;
+}
+
+IAccuracyModel::Outcomes_t AccuracyModel::Outcomes(uint_fast16_t standing, Pin target) const {
+    const auto pin = static_cast<int>(target);
+    Outcomes_t result;
+    const auto add = [&](uint_fast16_t after, double probability) {
+        if (probability <= 0)
+            return;
+        for (auto& i : result)
+            if (i.standing == after) {
+                i.probability += probability;
+                return;
+            }
+        result.push_back({static_cast<uint16_t>(after), probability});
+    };
+    add(Cascade(standing, pin), accuracy);
+    add(Cascade(standing, leftOf[pin]), (1 - accuracy) / 2);
+    add(Cascade(standing, rightOf[pin]), (1 - accuracy) / 2);
+    return result;
+}
@@ -0,0 +1,113 @@
+#include "AllocationTracker.h"
+
+#include <cstdlib>
+#include <new>
+
+// Replacement global allocation functions that report to AllocationTracker. Only
+// linked into programs built for instrumentation; see BowlingSimulatorAllocationHook.
+
+namespace {
+    const bool installed = (AllocationTracker::Install(), true);
+
+    void* Allocate(std::size_t size, std::size_t alignment = 0) {
+        AllocationTracker::Allocated(size);
+        if (!size)
+            size = 1;
+        void* p = alignment ? std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)
+                            : std::malloc(size);
+        return p;
+    }
+
+    void* AllocateOrThrow(std::size_t size, std::size_t alignment = 0) {
+        if (auto* p = Allocate(size, alignment))
+            return p;
+        throw std::bad_alloc{};
+    }
+
+    void Free(void* p) {
+        if (!p)
+            return;
+        AllocationTracker::Freed();
+        std::free(p);
+    }
+}
+
+void* operator new(std::size_t size) {
+    return AllocateOrThrow(size);
+}
+
+void* operator new[](std::size_t size) {
+    return AllocateOrThrow(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return AllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return AllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return Allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return Allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept {
+    Free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    Free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    Free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    Free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    Free(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept {
+    Free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+    Free(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept {
+    Free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+    Free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+    Free(p);
+}
+
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    Free(p);
+}
+
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    Free(p);
+}
@@ -0,0 +1,75 @@
+#include "AllocationTracker.h"
+
+#include <atomic>
+#include <numeric>
+
+namespace {
+    std::atomic<bool> installed{false};
+
+    // Constant initialized, so the operators can use it before main and on any thread.
+    thread_local AllocationStats stats;
+}
+
+uint64_t AllocationStats::Allocations() const {
+    return std::accumulate(allocations.begin(), allocations.end(), uint64_t{0});
+}
+
+uint64_t AllocationStats::Bytes() const {
+    return std::accumulate(bytes.begin(), bytes.end(), uint64_t{0});
+}
+
+uint64_t AllocationStats::Allocations(Subsystem subsystem) const {
+    return allocations[static_cast<std::size_t>(subsystem)];
+}
+
+uint64_t AllocationStats::Bytes(Subsystem subsystem) const {
+    return bytes[static_cast<std::size_t>(subsystem)];
+}
+
+AllocationStats AllocationStats::operator-(const AllocationStats& earlier) const {
+    AllocationStats result;
+    for (std::size_t i = 0; i < subsystems; ++i) {
+        result.allocations[i] = allocations[i] - earlier.allocations[i];
+        result.bytes[i] = bytes[i] - earlier.bytes[i];
+    }
+    result.frees = frees - earlier.frees;
+    return result;
+}
+
+bool AllocationTracker::Installed() {
+    return installed.load(std::memory_order_relaxed);
+}
+
+const char* AllocationTracker::Name(Subsystem subsystem) {
+    switch (subsystem) {
+        case Subsystem::OTHER:
+            return "other";
+        case Subsystem::FRAMES:
+            return "frames";
+        case Subsystem::PIN_SETS:
+            return "pin sets";
+        case Subsystem::ARENA:
+            return "arena";
+        case Subsystem::SESSIONS:
+            return "sessions";
+    }
+    return "unknown";
+}
+
+AllocationStats AllocationTracker::ThisThread() {
+    return stats;
+}
+
+void AllocationTracker::Install() {
+    installed.store(true, std::memory_order_relaxed);
+}
+
+void AllocationTracker::Allocated(std::size_t bytes) {
+    const auto i = static_cast<std::size_t>(current);
+    ++stats.allocations[i];
+    stats.bytes[i] += bytes;
+}
+
+void AllocationTracker::Freed() {
+    ++stats.frees;
+}
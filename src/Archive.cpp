@@ -0,0 +1,88 @@
+#include "Archive.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+ArchiveReader::ArchiveReader(const std::string& path) {
+    fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw ArchiveException{"Cannot open " + path + ": " + std::strerror(errno)};
+    struct stat info{};
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw ArchiveException{"Cannot stat " + path + ": " + std::strerror(errno)};
+    }
+    mappedSize = static_cast<std::size_t>(info.st_size);
+    if (mappedSize < sizeof(ArchiveHeader)) {
+        ::close(fd);
+        throw ArchiveException{path + " is too short to be an archive"};
+    }
+    mapping = ::mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+        ::close(fd);
+        throw ArchiveException{"Cannot map " + path + ": " + std::strerror(errno)};
+    }
+    ::madvise(mapping, mappedSize, MADV_SEQUENTIAL);
+
+    ArchiveHeader header;
+    std::memcpy(&header, mapping, sizeof(header));
+    const auto available = (mappedSize - sizeof(ArchiveHeader)) / sizeof(ArchiveRecord);
+    if (header.magic != ArchiveHeader::expectedMagic || header.version != ArchiveHeader::currentVersion ||
+        header.recordSize != sizeof(ArchiveRecord) || header.recordCount > available) {
+        ::munmap(mapping, mappedSize);
+        ::close(fd);
+        throw ArchiveException{path + " is not a version 1 game archive"};
+    }
+    records = {reinterpret_cast<const ArchiveRecord*>(static_cast<const std::byte*>(mapping) + sizeof(ArchiveHeader)),
+               static_cast<std::size_t>(header.recordCount)};
+}
+
+ArchiveReader::~ArchiveReader() {
+    ::munmap(mapping, mappedSize);
+    ::close(fd);
+}
+
+std::span<const ArchiveRecord> ArchiveReader::Records() const {
+    return records;
+}
+
+std::size_t ArchiveReader::Bytes() const {
+    return mappedSize;
+}
+
+ArchiveWriter::ArchiveWriter(const std::string& path) : out{path, std::ios::binary | std::ios::trunc} {
+    if (!out)
+        throw ArchiveException{"Cannot create " + path};
+    const ArchiveHeader header{};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+ArchiveWriter::~ArchiveWriter() {
+    if (out.is_open())
+        Finish();
+}
+
+void ArchiveWriter::Write(std::span<const ArchiveRecord> records) {
+    out.write(reinterpret_cast<const char*>(records.data()),
+              static_cast<std::streamsize>(records.size_bytes()));
+    recordCount += records.size();
+}
+
+bool ArchiveWriter::Finish() noexcept {
+    ArchiveHeader header{};
+    header.recordCount = recordCount;
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.close();
+    return !out.fail();
+}
+
+void ArchiveWriter::Close() {
+    if (!Finish())
+        throw ArchiveException{"Failed writing archive"};
+}
@@ -0,0 +1,58 @@
+#include "BallModel.h"
+
+#include <limits>
+
+BallModel::BallModel() {
+    for (uint_fast8_t standing = 1; standing <= 10; ++standing) {
+        pinfall[standing][0] = (11.0 - standing) / 11;
+        for (uint_fast8_t pins = 1; pins <= standing; ++pins)
+            pinfall[standing][pins] = 1.0 / 11;
+    }
+}
+
+BallModel::BallModel(const SkillModel& model, const SkillRecord& bowler) {
+    for (uint_fast8_t standing = 1; standing <= 10; ++standing)
+        pinfall[standing] = model.Pinfall(bowler, standing);
+}
+
+BallModel::BallModel(const Table& pinfall) : pinfall{pinfall} {
+}
+
+const BallModel::Pinfall& BallModel::operator[](uint_fast8_t standing) const {
+    return pinfall.at(standing);
+}
+
+const BallModel::Table& BallModel::Pinfalls() const {
+    return pinfall;
+}
+
+BallModel::Table BallModel::Cumulative() const {
+    Table result{};
+    for (uint_fast8_t standing = 1; standing <= 10; ++standing) {
+        double sum = 0;
+        for (uint_fast8_t pins = 0; pins <= standing; ++pins)
+            result[standing][pins] = sum += pinfall[standing][pins];
+        result[standing][standing] = std::numeric_limits<double>::infinity();
+    }
+    return result;
+}
+
+std::vector<BallModel::Distribution> BallModel::Remaining(const GameStateSpace& space) const {
+    std::vector<Distribution> remaining(space.Size());
+    remaining[space.End()][0] = 1;
+    for (auto id = space.End(); id-- > 0;) {
+        auto& result = remaining[id];
+        const auto standing = space.At(id).standing;
+        for (uint_fast8_t pins = 0; pins <= standing; ++pins) {
+            const auto next = space.Next(id, pins);
+            const auto probability = pinfall[standing][pins];
+            if (next == GameStateSpace::invalid || probability == 0)
+                continue;
+            const auto points = space.Points(id, pins);
+            const auto& after = remaining[next];
+            for (std::size_t i = 0; i + points < result.size(); ++i)
+                result[i + points] += probability * after[i];
+        }
+    }
+    return remaining;
+}
@@ -0,0 +1,49 @@
+#include "Footprint.h"
+
+#include "Archive.h"
+#include "FinalFrame.h"
+#include "Frame.h"
+#include "FrameSet.h"
+#include "GameArena.h"
+#include "LaneSession.h"
+#include "PinSet.h"
+#include "ReplayLog.h"
+#include "ScoreHistogram.h"
+#include "SkillModel.h"
+
+#include <array>
+#include <random>
+
+namespace {
+    template <typename T>
+    constexpr TypeFootprint Of(const char* name) {
+        return {name, sizeof(T), alignof(T)};
+    }
+}
+
+std::span<const TypeFootprint> Footprint::Types() {
+    static constexpr std::array types{
+            Of<PinSet>("PinSet"),
+            Of<Frame>("Frame"),
+            Of<FinalFrame>("FinalFrame"),
+            Of<HeapFrames>("HeapFrames"),
+            Of<FrameSet>("FrameSet"),
+            Of<InlineFrames>("InlineFrames"),
+            Of<InlineFrameSet>("InlineFrameSet"),
+            Of<GameArena>("GameArena"),
+            Of<LaneSession>("LaneSession"),
+            Of<ArchiveRecord>("ArchiveRecord"),
+            Of<ReplayEntry>("ReplayEntry"),
+            Of<SkillRecord>("SkillRecord"),
+            Of<Histogram>("Histogram"),
+    };
+    return types;
+}
+
+AllocationStats Footprint::Games(SimulationEngine engine, uint_fast64_t games) {
+    const Simulation simulation;
+    std::mt19937_64 rng{46};
+    const auto before = AllocationTracker::ThisThread();
+    simulation.Play(engine, games, rng, [](uint_fast16_t) {});
+    return AllocationTracker::ThisThread() - before;
+}
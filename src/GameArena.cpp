@@ -0,0 +1,29 @@
+#include "GameArena.h"
+
+#include "AllocationTracker.h"
+#include "FinalFrame.h"
+#include "Frame.h"
+#include "PinSet.h"
+#include "ResourceAllocated.h"
+
+std::size_t GameArena::BytesPerGame() {
+    return 9 * ResourceAllocated::AllocationSize(sizeof(Frame)) +
+           ResourceAllocated::AllocationSize(sizeof(FinalFrame)) +
+           10 * ResourceAllocated::AllocationSize(sizeof(PinSet));
+}
+
+GameArena::GameArena(std::size_t gamesPerBatch, std::pmr::memory_resource* upstream)
+        : buffer{[gamesPerBatch] {
+              AllocationTracker::Scope scope{Subsystem::ARENA};
+              return std::vector<std::byte>(gamesPerBatch * BytesPerGame());
+          }()},
+          arena{buffer.data(), buffer.size(), upstream} {
+}
+
+std::pmr::memory_resource* GameArena::Resource() {
+    return &arena;
+}
+
+void GameArena::Reset() {
+    arena.release();
+}
@@ -0,0 +1,90 @@
+#include "GameBatch.h"
+
+#include <algorithm>
+#include <bit>
+
+static constexpr uint16_t fullRack = 0b11'11'11'11'11;
+
+static inline uint16_t Mask(bool condition) {
+    return static_cast<uint16_t>(0 - static_cast<uint16_t>(condition));
+}
+
+static inline uint16_t Blend(uint16_t mask, uint16_t ifSet, uint16_t ifClear) {
+    return (ifSet & mask) | (ifClear & ~mask);
+}
+
+GameBatch::GameBatch(std::size_t games)
+        : frame(games), turnState(games), first(games), second(games), bonus(games), pins(games, fullRack),
+          bonusNext(games), bonusAfter(games), score(games) {
+}
+
+std::size_t GameBatch::Size() const {
+    return frame.size();
+}
+
+// Restrict-qualified parameters let the compiler vectorize without alias checks, and
+// the AVX2 clone is picked at load time where the CPU supports it.
+__attribute__((target_clones("avx2", "default")))
+static void BowlKernel(std::size_t count, const PinMask* __restrict ball, uint16_t* __restrict f,
+                       uint16_t* __restrict t, uint16_t* __restrict b1, uint16_t* __restrict b2,
+                       uint16_t* __restrict b3, uint16_t* __restrict p, uint16_t* __restrict bn,
+                       uint16_t* __restrict ba, uint16_t* __restrict s) {
+    for (std::size_t i = 0; i < count; ++i) {
+        const uint16_t active = Mask(f[i] < 10);
+        const uint16_t final = Mask(f[i] == 9);
+        const uint16_t ball0 = Mask(t[i] == 0);
+        const uint16_t ball1 = Mask(t[i] == 1);
+        const uint16_t ball2 = Mask(t[i] == 2);
+        const uint16_t after = p[i] & ball[i];
+        const uint16_t knocked = std::popcount(p[i]) - std::popcount(after);
+        const uint16_t cleared = Mask(after == 0);
+        const uint16_t frameEnds = ball1 | cleared;
+        const uint16_t finalContinues = ball0 | (ball1 & (Mask(b1[i] == 10) | cleared));
+
+        // A set mask is all ones, so adding it subtracts one: 10 + finalContinues is 9 or 10.
+        const uint16_t nextFrame = Blend(final, 10 + finalContinues, f[i] + (frameEnds & 1));
+        const uint16_t nextTurn = Blend(final, t[i] + 1, ~frameEnds & 1);
+        const uint16_t nextPins = Blend(cleared | (~final & frameEnds), fullRack, after);
+        const uint16_t nextBonus = ba[i] + (~final & cleared & 1);
+        const uint16_t nextBonusAfter = ~final & ball0 & cleared & 1;
+
+        s[i] += active & (knocked * (1 + bn[i]));
+        b1[i] = Blend(active & ball0, knocked, b1[i]);
+        b2[i] = Blend(active & ball1, knocked, b2[i]);
+        b3[i] = Blend(active & ball2, knocked, b3[i]);
+        f[i] = Blend(active, nextFrame, f[i]);
+        t[i] = Blend(active, nextTurn, t[i]);
+        p[i] = Blend(active, nextPins, p[i]);
+        bn[i] = Blend(active, nextBonus, bn[i]);
+        ba[i] = Blend(active, nextBonusAfter, ba[i]);
+    }
+}
+
+void GameBatch::BowlAll(std::span<const PinMask> balls) {
+    BowlKernel(std::min(balls.size(), Size()), balls.data(), frame.data(), turnState.data(), first.data(),
+               second.data(), bonus.data(), pins.data(), bonusNext.data(), bonusAfter.data(), score.data());
+}
+
+void GameBatch::ScoreAll(std::span<uint16_t> out) const {
+    std::copy_n(score.begin(), std::min(out.size(), Size()), out.begin());
+}
+
+bool GameBatch::Ended(std::size_t game) const {
+    return frame[game] == 10;
+}
+
+std::size_t GameBatch::EndedCount() const {
+    return std::count(frame.begin(), frame.end(), 10);
+}
+
+void GameBatch::Reset() {
+    std::fill(frame.begin(), frame.end(), 0);
+    std::fill(turnState.begin(), turnState.end(), 0);
+    std::fill(first.begin(), first.end(), 0);
+    std::fill(second.begin(), second.end(), 0);
+    std::fill(bonus.begin(), bonus.end(), 0);
+    std::fill(pins.begin(), pins.end(), fullRack);
+    std::fill(bonusNext.begin(), bonusNext.end(), 0);
+    std::fill(bonusAfter.begin(), bonusAfter.end(), 0);
+    std::fill(score.begin(), score.end(), 0);
+}
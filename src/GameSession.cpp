@@ -0,0 +1,100 @@
+#include "GameSession.h"
+
+#include <cstring>
+
+// The resource that allocated a coroutine frame is stored just past the end of it.
+static constexpr std::size_t trailerAlign = alignof(std::pmr::memory_resource*);
+
+static std::size_t TrailerOffset(std::size_t size) {
+    return (size + trailerAlign - 1) / trailerAlign * trailerAlign;
+}
+
+GameSession GameSession::promise_type::get_return_object() {
+    return GameSession{std::coroutine_handle<promise_type>::from_promise(*this)};
+}
+
+std::suspend_always GameSession::promise_type::yield_value(const ScoreUpdate& newUpdate) noexcept {
+    update = newUpdate;
+    return {};
+}
+
+void GameSession::promise_type::unhandled_exception() noexcept {
+    exception = std::current_exception();
+}
+
+void* GameSession::promise_type::Allocate(std::size_t size, std::pmr::memory_resource& resource) {
+    const auto offset = TrailerOffset(size);
+    auto* frame = static_cast<char*>(resource.allocate(offset + sizeof(std::pmr::memory_resource*)));
+    auto* owner = &resource;
+    std::memcpy(frame + offset, &owner, sizeof(owner));
+    return frame;
+}
+
+void* GameSession::promise_type::operator new(std::size_t size, std::allocator_arg_t,
+                                              std::pmr::memory_resource& resource, InlineFrameSet&) {
+    return Allocate(size, resource);
+}
+
+void* GameSession::promise_type::operator new(std::size_t size) {
+    return Allocate(size, *std::pmr::new_delete_resource());
+}
+
+void GameSession::promise_type::operator delete(void* frame, std::size_t size) {
+    const auto offset = TrailerOffset(size);
+    std::pmr::memory_resource* owner;
+    std::memcpy(&owner, static_cast<char*>(frame) + offset, sizeof(owner));
+    owner->deallocate(frame, offset + sizeof(owner));
+}
+
+GameSession::GameSession(std::coroutine_handle<promise_type> handle) : handle{handle} {
+}
+
+GameSession::GameSession(GameSession&& other) noexcept : handle{std::exchange(other.handle, nullptr)} {
+}
+
+GameSession& GameSession::operator=(GameSession&& other) noexcept {
+    if (this != &other) {
+        if (handle)
+            handle.destroy();
+        handle = std::exchange(other.handle, nullptr);
+    }
+    return *this;
+}
+
+GameSession::~GameSession() {
+    if (handle)
+        handle.destroy();
+}
+
+GameSession GameSession::Play(std::allocator_arg_t, std::pmr::memory_resource&, InlineFrameSet& frameSet) {
+    uint_fast8_t turn = 0;
+    while (!frameSet.Ended()) {
+        const auto& pins = co_await NextBall{};
+        const auto frame = frameSet.CurrentFrame();
+        frameSet.Bowled(pins);
+        co_yield ScoreUpdate{frame, ++turn, frameSet.Score(), frameSet.Ended()};
+    }
+}
+
+GameSession GameSession::Play(InlineFrameSet& frameSet) {
+    return Play(std::allocator_arg, *std::pmr::new_delete_resource(), frameSet);
+}
+
+const ScoreUpdate& GameSession::Bowled(const IPinSet& pins) {
+    if (Ended())
+        throw FrameEndedException{"This game has ended"};
+    auto& promise = handle.promise();
+    promise.ball = &pins;
+    handle.resume();
+    if (promise.exception)
+        std::rethrow_exception(std::exchange(promise.exception, nullptr));
+    return promise.update;
+}
+
+bool GameSession::Ended() const {
+    return !handle || handle.done() || handle.promise().update.ended;
+}
+
+const ScoreUpdate& GameSession::LastUpdate() const {
+    return handle.promise().update;
+}
@@ -0,0 +1,177 @@
+#include "GameStateSpace.h"
+
+#include "FinalFrame.h"
+#include "Frame.h"
+#include "PinSet.h"
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <numeric>
+
+static PinSet KnockedDown(uint_fast8_t count) {
+    PinSet pins;
+    for (auto i = 0; i < count; ++i)
+        pins.KnockDownPin(static_cast<Pin>(i));
+    return pins;
+}
+
+// Turn ends and strikes/spares come from the real frames: each state keeps the
+// balls bowled so far in its frame (as pins down on the rack after each), and
+// every transition replays them into a fresh Frame or FinalFrame.
+GameStateSpace::GameStateSpace(GameRules rules) {
+    constexpr State end{10, 0, 0};
+    std::map<State, uint16_t> ids;
+    std::vector<std::vector<uint8_t>> histories;
+    std::deque<uint16_t> queue;
+    const auto Find = [&](const State& state, std::vector<uint8_t> history) {
+        const auto [found, inserted] = ids.try_emplace(state, static_cast<uint16_t>(states.size()));
+        if (inserted) {
+            states.push_back(state);
+            histories.push_back(std::move(history));
+            next.emplace_back().fill(invalid);
+            points.emplace_back();
+            if (state != end)
+                queue.push_back(found->second);
+        }
+        return found->second;
+    };
+
+    Find(State{}, {});
+    while (!queue.empty()) {
+        const auto id = queue.front();
+        queue.pop_front();
+        const auto state = states[id];
+        const auto finalFrame = state.frame == 9 && rules.tenthFrameBonus;
+        for (uint_fast8_t pins = 0; pins <= state.standing; ++pins) {
+            std::unique_ptr<IFrame> frame;
+            if (!finalFrame)
+                frame = std::make_unique<Frame>(std::make_unique<PinSet>());
+            else
+                frame = std::make_unique<FinalFrame>(std::make_unique<PinSet>());
+            for (auto i : histories[id])
+                frame->Bowled(KnockedDown(i));
+            const auto down = static_cast<uint8_t>(10 - state.standing + pins);
+            frame->Bowled(KnockedDown(down));
+
+            points[id][pins] = static_cast<uint8_t>(pins * (1 + state.bonusNext));
+            State following{state.frame, static_cast<uint8_t>(state.ball + 1),
+                            static_cast<uint8_t>(10 - down), state.bonusAfter, 0, false};
+            auto history = histories[id];
+            history.push_back(down);
+            if (state.frame < 9) {
+                const auto score = frame->Score();
+                if (std::holds_alternative<IFrame::Strike>(score)) {
+                    ++following.bonusNext;
+                    following.bonusAfter = 1;
+                } else if (std::holds_alternative<IFrame::Spare>(score)) {
+                    ++following.bonusNext;
+                }
+            } else if (finalFrame && down == 10) {
+                following.standing = 10;
+                following.fillBall = state.ball == 0;
+            }
+            if (frame->TurnEnded()) {
+                if (state.frame == 9) {
+                    next[id][pins] = Find(end, {});
+                    continue;
+                }
+                following.frame = state.frame + 1;
+                following.ball = 0;
+                following.standing = 10;
+                history.clear();
+            }
+            next[id][pins] = Find(following, std::move(history));
+        }
+    }
+
+    // Renumber in (frame, ball) order so every transition leads to a higher ID
+    // and the end of the game is the last one.
+    std::vector<uint16_t> order(states.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](auto lhs, auto rhs) { return states[lhs] < states[rhs]; });
+    std::vector<uint16_t> renumbered(states.size());
+    for (std::size_t i = 0; i < order.size(); ++i)
+        renumbered[order[i]] = static_cast<uint16_t>(i);
+    decltype(states) sortedStates;
+    decltype(next) sortedNext;
+    decltype(points) sortedPoints;
+    for (auto i : order) {
+        sortedStates.push_back(states[i]);
+        sortedPoints.push_back(points[i]);
+        auto& row = sortedNext.emplace_back(next[i]);
+        for (auto& j : row)
+            if (j != invalid)
+                j = renumbered[j];
+    }
+    states = std::move(sortedStates);
+    next = std::move(sortedNext);
+    points = std::move(sortedPoints);
+}
+
+std::size_t GameStateSpace::Size() const {
+    return states.size();
+}
+
+uint16_t GameStateSpace::Start() const {
+    return 0;
+}
+
+uint16_t GameStateSpace::End() const {
+    return static_cast<uint16_t>(states.size() - 1);
+}
+
+const GameStateSpace::State& GameStateSpace::At(uint16_t id) const {
+    return states.at(id);
+}
+
+uint16_t GameStateSpace::Next(uint16_t id, uint_fast8_t pins) const {
+    return pins > 10 ? invalid : next.at(id)[pins];
+}
+
+uint_fast8_t GameStateSpace::Points(uint16_t id, uint_fast8_t pins) const {
+    return pins > 10 ? 0 : points.at(id)[pins];
+}
+
+void GameStateSpace::WriteHeader(std::ostream& out) const {
+    const auto Row = [&](const auto& row) {
+        out << "{";
+        for (std::size_t i = 0; i < row.size(); ++i)
+            out << (i ? ", " : "") << +row[i];
+        out << "}";
+    };
+    const auto Column = [&](auto member) {
+        out << "{";
+        for (std::size_t i = 0; i < states.size(); ++i)
+            out << (i ? (i % 24 ? ", " : ",\n            ") : "") << +(states[i].*member);
+        out << "}";
+    };
+
+    out << "// Generated by GenerateGameStates from the Frame and FinalFrame rules. Do not edit.\n"
+        << "#ifndef BOWLINGSIMULATOR_GAMESTATETABLE_H\n"
+        << "#define BOWLINGSIMULATOR_GAMESTATETABLE_H\n\n"
+        << "#include <array>\n"
+        << "#include <cstdint>\n\n"
+        << "struct GameStateTable {\n"
+        << "    static constexpr uint16_t stateCount = " << states.size() << ";\n"
+        << "    static constexpr uint16_t start = " << Start() << ";\n"
+        << "    static constexpr uint16_t end = " << End() << ";\n"
+        << "    static constexpr uint16_t invalid = " << invalid << ";\n\n";
+    out << "    static constexpr std::array<uint8_t, stateCount> frame";
+    Column(&State::frame);
+    out << ";\n    static constexpr std::array<uint8_t, stateCount> standing";
+    Column(&State::standing);
+    out << ";\n\n    static constexpr std::array<std::array<uint16_t, 11>, stateCount> next{{\n";
+    for (const auto& i : next) {
+        out << "        ";
+        Row(i);
+        out << ",\n";
+    }
+    out << "    }};\n\n    static constexpr std::array<std::array<uint8_t, 11>, stateCount> points{{\n";
+    for (const auto& i : points) {
+        out << "        ";
+        Row(i);
+        out << ",\n";
+    }
+    out << "    }};\n};\n\n#endif //BOWLINGSIMULATOR_GAMESTATETABLE_H\n";
+}
@@ -0,0 +1,65 @@
+#include "LaneSession.h"
+
+#include "AllocationTracker.h"
+
+#include <stdexcept>
+
+LaneSession::LaneSession(std::size_t bowlers, uint8_t startLane, ILaneListener* listener,
+                         std::pmr::memory_resource* resource)
+        : games{resource}, listener{listener}, startLane{static_cast<uint8_t>(startLane % 2)} {
+    if (bowlers == 0 || bowlers > maxBowlers)
+        throw std::invalid_argument{"A lane session has between 1 and 6 bowlers"};
+    AllocationTracker::Scope scope{Subsystem::SESSIONS};
+    games.resize(bowlers);
+}
+
+void LaneSession::Bowled(const IPinSet& pins) {
+    if (Ended())
+        throw FrameEndedException{"This session has ended"};
+    auto& game = games[bowler];
+    const auto frame = game.CurrentFrame();
+    const auto lane = CurrentLane();
+    game.Bowled(pins);
+    const auto frameEnded = game.CurrentFrame() != frame;
+    if (listener) {
+        // Frames after the current one repeat the running total.
+        const auto score = static_cast<uint16_t>(game.FrameScores().back());
+        uint16_t standing = 0;
+        for (auto i = 0; i < 10; ++i)
+            standing |= pins.IsUp(static_cast<Pin>(i)) << i;
+        listener->BallBowled({bowler, frame, ball, lane, standing, score});
+        if (frameEnded)
+            listener->FrameEnded({bowler, frame, lane, score, game.Ended()});
+    }
+    if (!frameEnded) {
+        ++ball;
+        return;
+    }
+    ball = 0;
+    if (++bowler == games.size())
+        bowler = 0;
+}
+
+bool LaneSession::Ended() const {
+    return games.back().Ended();
+}
+
+std::size_t LaneSession::Bowlers() const {
+    return games.size();
+}
+
+std::size_t LaneSession::CurrentBowler() const {
+    return bowler;
+}
+
+uint_fast8_t LaneSession::CurrentFrame() const {
+    return games[bowler].CurrentFrame();
+}
+
+uint_fast8_t LaneSession::CurrentLane() const {
+    return (startLane + CurrentFrame()) % 2;
+}
+
+const InlineFrameSet& LaneSession::Game(std::size_t bowler) const {
+    return games.at(bowler);
+}
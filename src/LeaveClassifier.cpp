@@ -0,0 +1,21 @@
+#include "LeaveClassifier.h"
+
+Leave LeaveClassifier::Classify(const IPinSet& pins) {
+    uint_fast16_t standing = 0;
+    for (auto i = 0; i < 10; ++i)
+        if (pins.IsUp(static_cast<Pin>(i)))
+            standing |= uint_fast16_t{1} << i;
+    return Classify(standing);
+}
+
+void LeaveClassifier::ClassifyAll(const uint16_t* standing, std::size_t count, Leave* out) {
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = table[standing[i] & allPins];
+}
+
+std::array<std::size_t, 6> LeaveClassifier::CountTypes(const uint16_t* standing, std::size_t count) {
+    std::array<std::size_t, 6> counts{};
+    for (std::size_t i = 0; i < count; ++i)
+        ++counts[static_cast<uint8_t>(table[standing[i] & allPins].type)];
+    return counts;
+}
@@ -1,40 +1,32 @@
 #include "PinSet.h"
 
-bool PinSet::AllPinsUp() const {
-    return pins.all();
-}
+#include <algorithm>
+#include <bit>
 
-bool PinSet::AllPinsDown() const {
-    return pins.none();
-}
+// Restrict-qualified loops over PinSet's scalar operations; the AVX2 clone is
+// picked at load time where the CPU supports it.
+struct PinSetKernels {
+    __attribute__((target_clones("avx2", "default")))
+    static void And(std::size_t count, uint16_t* __restrict racks, const uint16_t* __restrict balls) {
+        for (std::size_t i = 0; i < count; ++i)
+            racks[i] = PinSet::And(racks[i], balls[i]);
+    }
 
-void PinSet::KnockDownPin(Pin p) {
-    pins[static_cast<uint8_t>(p)] = false;
-}
-
-bool PinSet::IsDown(Pin p) const {
-    return !pins.test(static_cast<uint8_t>(p));
-}
-
-bool PinSet::IsUp(Pin p) const {
-    return !IsDown(p);
-}
-
-uint_fast8_t PinSet::PinsUp() const {
-    return pins.count();
-}
+    __attribute__((target_clones("avx2", "default")))
+    static void Popcount(std::size_t count, const uint16_t* __restrict racks, uint8_t* __restrict counts) {
+        for (std::size_t i = 0; i < count; ++i)
+            counts[i] = static_cast<uint8_t>(std::popcount(racks[i]));
+    }
+};
 
-uint_fast8_t PinSet::PinsDown() const {
-    return pins.size() - pins.count();
+void PinSet::AndAll(std::span<uint16_t> racks, std::span<const uint16_t> balls) {
+    PinSetKernels::And(std::min(racks.size(), balls.size()), racks.data(), balls.data());
 }
 
-IPinSet& PinSet::operator&=(const IPinSet& rhs) {
-    for (auto i = 0; i < 10; ++i)
-        if (rhs.IsDown(static_cast<Pin>(i)))
-            pins[i] = false;
-    return *this;
+void PinSet::PopcountAll(std::span<const uint16_t> racks, std::span<uint8_t> counts) {
+    PinSetKernels::Popcount(std::min(racks.size(), counts.size()), racks.data(), counts.data());
 }
 
-void PinSet::Reset() {
-    pins.set();
+void PinSet::ResetAll(std::span<uint16_t> racks) {
+    std::fill(racks.begin(), racks.end(), fullRack);
 }
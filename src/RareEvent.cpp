@@ -0,0 +1,174 @@
+#include "RareEvent.h"
+
+#include "FrameSet.h"
+#include "GameStateTable.h"
+#include "PinSet.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+    // One series in progress. points is this game's score as GameStateTable credits
+    // it, so points plus the most the state can still add bounds the final score.
+    struct Particle {
+        InlineFrameSet frameSet{};
+        uint16_t standing = SkillModel::fullRack;
+        uint16_t state = GameStateTable::start;
+        uint_fast8_t game = 0;
+        uint_fast16_t points = 0;
+        uint_fast16_t total = 0;
+
+        void Bowled(uint_fast8_t pins) {
+            auto after = standing;
+            for (auto i = 0; i < pins; ++i)
+                after &= after - 1;
+            const auto frame = frameSet.CurrentFrame();
+            frameSet.Bowled(PinSet{after});
+            standing = after == 0 || frameSet.CurrentFrame() != frame ? SkillModel::fullRack : after;
+            points += GameStateTable::points[state][pins];
+            state = GameStateTable::next[state][pins];
+        }
+
+        // On to the next game of the series once this one is over.
+        void NextGame() {
+            total += frameSet.Score();
+            frameSet = InlineFrameSet{};
+            standing = SkillModel::fullRack;
+            state = GameStateTable::start;
+            points = 0;
+            ++game;
+        }
+    };
+
+    RareEventEstimate Summarize(double probability, double standardError, double games, uint_fast8_t seriesGames) {
+        RareEventEstimate result;
+        result.probability = probability;
+        result.standardError = standardError;
+        result.low = std::max(0.0, probability - 1.96 * standardError);
+        result.high = std::min(1.0, probability + 1.96 * standardError);
+        result.games = games;
+        if (standardError > 0)
+            result.naiveGames = probability * (1 - probability) / (standardError * standardError) * seriesGames;
+        else if (probability > 0)
+            result.naiveGames = std::numeric_limits<double>::infinity();
+        return result;
+    }
+}
+
+RareEvent::RareEvent() = default;
+
+RareEvent::RareEvent(const SkillModel& model, const SkillRecord& bowler) : balls{model, bowler} {
+}
+
+const RareEvent::Pinfall& RareEvent::Base(uint_fast8_t standing) const {
+    return balls[standing];
+}
+
+RareEventEstimate RareEvent::Estimate(const Options& options) const {
+    if (!options.games || !options.samples)
+        return {};
+    return options.method == RareEventMethod::IMPORTANCE_SAMPLING ? ImportanceSampling(options) : Splitting(options);
+}
+
+RareEventEstimate RareEvent::ImportanceSampling(const Options& options) const {
+    // Clears the rack with strikeBias and keeps the other counts in proportion;
+    // ratio is the weight a ball carries back to the real pinfall.
+    auto proposal = balls.Pinfalls();
+    BallModel::Table ratio{};
+    for (uint_fast8_t standing = 1; standing <= 10; ++standing) {
+        const auto& p = balls[standing];
+        auto& q = proposal[standing];
+        if (options.strikeBias > p[standing] && p[standing] > 0 && p[standing] < 1) {
+            const auto scale = (1 - options.strikeBias) / (1 - p[standing]);
+            for (uint_fast8_t pins = 0; pins < standing; ++pins)
+                q[pins] = p[pins] * scale;
+            q[standing] = options.strikeBias;
+        }
+        for (uint_fast8_t pins = 0; pins <= standing; ++pins)
+            ratio[standing][pins] = q[pins] > 0 ? p[pins] / q[pins] : 0;
+    }
+    const auto cumulative = BallModel{proposal}.Cumulative();
+
+    std::mt19937_64 rng{options.seed};
+    double sum = 0, sumOfSquares = 0;
+    for (uint64_t sample = 0; sample < options.samples; ++sample) {
+        Particle series;
+        double weight = 1;
+        while (series.game < options.games) {
+            const auto up = std::popcount(series.standing);
+            const auto pins = BallModel::Draw(cumulative[up], rng);
+            weight *= ratio[up][pins];
+            series.Bowled(pins);
+            if (series.state == GameStateTable::end)
+                series.NextGame();
+        }
+        if (series.total >= options.threshold) {
+            sum += weight;
+            sumOfSquares += weight * weight;
+        }
+    }
+    const auto n = static_cast<double>(options.samples);
+    const auto probability = sum / n;
+    const auto variance = n > 1 ? std::max(0.0, (sumOfSquares - n * probability * probability) / (n - 1)) : 0;
+    return Summarize(probability, std::sqrt(variance / n), n * options.games, options.games);
+}
+
+RareEventEstimate RareEvent::Splitting(const Options& options) const {
+    // The most points each state can still add, given which counts are possible.
+    std::array<uint_fast16_t, GameStateTable::stateCount> most{};
+    for (auto id = GameStateTable::end; id-- > 0;) {
+        const auto standing = GameStateTable::standing[id];
+        for (uint_fast8_t pins = 0; pins <= standing; ++pins) {
+            const auto next = GameStateTable::next[id][pins];
+            if (next != GameStateTable::invalid && balls[standing][pins] > 0)
+                most[id] = std::max<uint_fast16_t>(most[id], GameStateTable::points[id][pins] + most[next]);
+        }
+    }
+    const auto reachable = [&](const Particle& particle) {
+        const auto laterGames = options.games - particle.game - 1;
+        return particle.total + particle.points + most[particle.state] + 300u * laterGames >= options.threshold;
+    };
+
+    const auto cumulative = balls.Cumulative();
+    const auto replications = std::max<uint_fast8_t>(options.replications, 2);
+    std::mt19937_64 rng{options.seed};
+    std::vector<Particle> particles, survivors;
+    std::vector<double> estimates;
+    double games = 0;
+    for (uint_fast8_t replication = 0; replication < replications; ++replication) {
+        particles.assign(options.samples, Particle{});
+        double probability = 1;
+        for (auto level = 0; level < 10 * options.games; ++level) {
+            survivors.clear();
+            for (auto& particle : particles) {
+                const auto frame = GameStateTable::frame[particle.state];
+                while (particle.state != GameStateTable::end && GameStateTable::frame[particle.state] == frame)
+                    particle.Bowled(BallModel::Draw(cumulative[std::popcount(particle.standing)], rng));
+                if (!reachable(particle))
+                    continue;
+                if (particle.state == GameStateTable::end && particle.game + 1 < options.games)
+                    particle.NextGame();
+                survivors.push_back(particle);
+            }
+            games += particles.size() / 10.0;
+            probability *= static_cast<double>(survivors.size()) / particles.size();
+            if (survivors.empty())
+                break;
+            for (auto& particle : particles)
+                particle = survivors[rng() % survivors.size()];
+        }
+        estimates.push_back(probability);
+    }
+
+    double mean = 0;
+    for (auto i : estimates)
+        mean += i / replications;
+    double variance = 0;
+    for (auto i : estimates)
+        variance += (i - mean) * (i - mean) / (replications - 1);
+    return Summarize(mean, std::sqrt(variance / replications), games, options.games);
+}
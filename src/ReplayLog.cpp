@@ -0,0 +1,91 @@
+#include "ReplayLog.h"
+
+#include "LittleEndian.h"
+
+#include <bit>
+#include <optional>
+#include <string>
+
+namespace {
+    using ::LittleEndian;
+
+    ReplayHeader LittleEndian(ReplayHeader header) {
+        header.version = LittleEndian(header.version);
+        header.ruleVersion = LittleEndian(header.ruleVersion);
+        header.seed = LittleEndian(header.seed);
+        header.reserved = LittleEndian(header.reserved);
+        return header;
+    }
+
+    ReplayEntry LittleEndian(ReplayEntry entry) {
+        return {LittleEndian(entry.ball), LittleEndian(entry.check)};
+    }
+}
+
+ReplayRecorder::ReplayRecorder(std::ostream& out, uint64_t seed)
+        : out{out}, buffer(bufferEntries), next{buffer.data()} {
+    ReplayHeader header;
+    header.ruleVersion = ruleVersion;
+    header.seed = seed;
+    header = LittleEndian(header);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+ReplayRecorder::~ReplayRecorder() {
+    Flush();
+}
+
+void ReplayRecorder::Flush() {
+    if constexpr (std::endian::native == std::endian::big)
+        for (auto* i = buffer.data(); i != next; ++i)
+            *i = LittleEndian(*i);
+    out.write(reinterpret_cast<const char*>(buffer.data()), (next - buffer.data()) * sizeof(ReplayEntry));
+    next = buffer.data();
+}
+
+ReplayResult ReplayLog::Replay(std::istream& in) {
+    ReplayHeader header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    header = LittleEndian(header);
+    if (!in || header.magic != ReplayHeader::expectedMagic)
+        throw ReplayException{"Not a replay log"};
+    if (header.version != ReplayHeader::currentVersion)
+        throw ReplayException{"Unsupported replay log version " + std::to_string(header.version)};
+    if (header.ruleVersion != ReplayRecorder::ruleVersion)
+        throw ReplayException{"The log was recorded under rule version " + std::to_string(header.ruleVersion) +
+                              ", this build scores under " + std::to_string(ReplayRecorder::ruleVersion)};
+
+    ReplayResult result;
+    result.seed = header.seed;
+    std::optional<InlineFrameSet> frameSet;
+    std::vector<ReplayEntry> entries(ReplayRecorder::bufferEntries);
+    while (in) {
+        in.read(reinterpret_cast<char*>(entries.data()), entries.size() * sizeof(ReplayEntry));
+        const auto count = static_cast<std::size_t>(in.gcount()) / sizeof(ReplayEntry);
+        for (std::size_t i = 0; i < count; ++i, ++result.balls) {
+            const auto entry = LittleEndian(entries[i]);
+            if ((entry.ball & ReplayEntry::newGame) || !frameSet) {
+                frameSet.emplace();
+                ++result.games;
+            }
+            const auto mask = static_cast<uint16_t>(entry.ball & ~ReplayEntry::newGame);
+            uint16_t actual;
+            try {
+                frameSet->Bowled(PinSet{mask});
+                actual = ReplayEntry::Check(frameSet->CurrentFrame(), frameSet->FrameScores().back());
+            } catch (const FrameEndedException&) {
+                // A ball the rules do not allow can never match.
+                actual = static_cast<uint16_t>(~entry.check);
+            }
+            if (actual != entry.check) {
+                result.diverged = true;
+                result.divergedBall = result.balls;
+                result.divergedGame = result.games - 1;
+                result.expected = entry.check;
+                result.actual = actual;
+                return result;
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,228 @@
+#include "RescorePipeline.h"
+
+#include "BoundedQueue.h"
+#include "FrameSet.h"
+#include "GameBatch.h"
+#include "PinSet.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <semaphore>
+#include <thread>
+#include <vector>
+
+namespace {
+    constexpr uint16_t invalidScore = 0xFFFF;
+
+    struct DecodedGame {
+        std::array<uint16_t, 21> balls{};
+        uint8_t ballCount = 0;
+    };
+
+    struct Chunk {
+        std::size_t index = 0;
+        std::span<const ArchiveRecord> records;
+        std::vector<DecodedGame> games;
+        std::vector<uint16_t> scores;
+        std::vector<ArchiveRecord> output;
+        std::vector<std::size_t> changed;
+        std::size_t invalid = 0;
+    };
+
+    using ChunkQueue = BoundedQueue<std::unique_ptr<Chunk>>;
+
+    void Decode(Chunk& chunk) {
+        chunk.games.resize(chunk.records.size());
+        for (std::size_t i = 0; i < chunk.records.size(); ++i) {
+            const auto& record = chunk.records[i];
+            auto& game = chunk.games[i];
+            game.ballCount = record.ballCount;
+            for (std::size_t ball = 0; ball < std::min<std::size_t>(game.ballCount, 21); ++ball)
+                game.balls[ball] = record.balls[ball] & 0x3FF;
+        }
+    }
+
+    PinSet FromMask(uint16_t standing) {
+        PinSet pins;
+        for (auto i = 0; i < 10; ++i)
+            if (!(standing & (1u << i)))
+                pins.KnockDownPin(static_cast<Pin>(i));
+        return pins;
+    }
+
+    void ScoreWithFrameSet(Chunk& chunk) {
+        chunk.scores.resize(chunk.games.size());
+        for (std::size_t i = 0; i < chunk.games.size(); ++i) {
+            const auto& game = chunk.games[i];
+            auto score = invalidScore;
+            if (game.ballCount <= 21) {
+                InlineFrameSet frameSet{};
+                std::size_t ball = 0;
+                for (; ball < game.ballCount && !frameSet.Ended(); ++ball)
+                    frameSet.Bowled(FromMask(game.balls[ball]));
+                if (ball == game.ballCount && frameSet.Ended())
+                    score = static_cast<uint16_t>(frameSet.Score());
+            }
+            chunk.scores[i] = score;
+        }
+    }
+
+    // Games shorter than 21 balls are padded with balls that knock nothing down,
+    // so a game is only valid if it ends exactly on its own last ball.
+    void ScoreWithBatch(Chunk& chunk) {
+        const auto count = chunk.games.size();
+        GameBatch batch{count};
+        std::vector<PinMask> balls(count);
+        std::vector<uint8_t> valid(count);
+        for (std::size_t i = 0; i < count; ++i)
+            valid[i] = chunk.games[i].ballCount > 0 && chunk.games[i].ballCount <= 21;
+        for (std::size_t ball = 0; ball < 21; ++ball) {
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto& game = chunk.games[i];
+                if (ball < game.ballCount && batch.Ended(i))
+                    valid[i] = false;
+                balls[i] = ball < game.ballCount ? game.balls[ball] : 0x3FF;
+            }
+            batch.BowlAll(balls);
+            for (std::size_t i = 0; i < count; ++i)
+                if (ball + 1 == chunk.games[i].ballCount && !batch.Ended(i))
+                    valid[i] = false;
+        }
+        chunk.scores.resize(count);
+        batch.ScoreAll(chunk.scores);
+        for (std::size_t i = 0; i < count; ++i)
+            if (!valid[i])
+                chunk.scores[i] = invalidScore;
+    }
+
+    void Diff(Chunk& chunk) {
+        chunk.output.assign(chunk.records.begin(), chunk.records.end());
+        for (std::size_t i = 0; i < chunk.output.size(); ++i) {
+            if (chunk.scores[i] == invalidScore) {
+                ++chunk.invalid;
+            } else if (chunk.scores[i] != chunk.output[i].storedScore) {
+                chunk.changed.push_back(i);
+                chunk.output[i].storedScore = chunk.scores[i];
+            }
+        }
+    }
+
+    // Runs a pool of threads over one stage and closes the next queue when the last
+    // one finishes. Each thread gets its own worker from makeWorker.
+    template <typename MakeWorker>
+    void StartStage(std::vector<std::thread>& threads, unsigned count, ChunkQueue& in, ChunkQueue& out,
+                    MakeWorker makeWorker) {
+        count = std::max(1u, count);
+        auto remaining = std::make_shared<std::atomic<unsigned>>(count);
+        for (unsigned t = 0; t < count; ++t) {
+            threads.emplace_back([&in, &out, makeWorker, remaining] {
+                auto work = makeWorker();
+                while (auto chunk = in.Pop()) {
+                    work(**chunk);
+                    out.Push(std::move(*chunk));
+                }
+                if (--*remaining == 0)
+                    out.Close();
+            });
+        }
+    }
+}
+
+double RescoreProgress::RecordsPerSecond() const {
+    return seconds > 0 ? records / seconds : 0;
+}
+
+double RescoreProgress::BytesPerSecond() const {
+    return RecordsPerSecond() * sizeof(ArchiveRecord);
+}
+
+RescorePipeline::RescorePipeline(Options options) : options{std::move(options)} {
+}
+
+RescoreProgress RescorePipeline::Run(const ArchiveReader& input, ArchiveWriter& output, std::ostream* diff) {
+    const auto records = input.Records();
+    const auto chunkRecords = std::max<std::size_t>(options.chunkRecords, 1);
+    const auto start = std::chrono::steady_clock::now();
+    ChunkQueue decodeQueue{options.queueCapacity}, scoreQueue{options.queueCapacity},
+            diffQueue{options.queueCapacity}, writeQueue{options.queueCapacity};
+    std::counting_semaphore<> inFlight{static_cast<std::ptrdiff_t>(std::max<std::size_t>(options.maxChunksInFlight, 1))};
+    std::atomic<std::size_t> written{0}, changed{0}, invalid{0};
+
+    std::vector<std::thread> threads;
+    threads.emplace_back([&] {
+        for (std::size_t first = 0, index = 0; first < records.size(); first += chunkRecords, ++index) {
+            inFlight.acquire();
+            auto chunk = std::make_unique<Chunk>();
+            chunk->index = index;
+            chunk->records = records.subspan(first, std::min(chunkRecords, records.size() - first));
+            decodeQueue.Push(std::move(chunk));
+        }
+        decodeQueue.Close();
+    });
+    StartStage(threads, options.decodeThreads, decodeQueue, scoreQueue, [] { return Decode; });
+    StartStage(threads, options.scoreThreads, scoreQueue, diffQueue, [engine = options.engine] {
+        return [engine](Chunk& chunk) {
+            if (engine == RescoreEngine::FRAMESET)
+                ScoreWithFrameSet(chunk);
+            else
+                ScoreWithBatch(chunk);
+        };
+    });
+    StartStage(threads, options.diffThreads, diffQueue, writeQueue, [] { return Diff; });
+
+    std::mutex progressMutex;
+    std::condition_variable progressWake;
+    bool finished = false;
+    const auto Snapshot = [&] {
+        RescoreProgress progress;
+        progress.records = written;
+        progress.totalRecords = records.size();
+        progress.changed = changed;
+        progress.invalid = invalid;
+        progress.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return progress;
+    };
+    std::thread reporter;
+    if (options.progress) {
+        reporter = std::thread{[&] {
+            std::unique_lock lock{progressMutex};
+            while (!progressWake.wait_for(lock, options.progressInterval, [&] { return finished; }))
+                options.progress(Snapshot());
+        }};
+    }
+
+    // The writer runs here, putting chunks back in archive order.
+    std::map<std::size_t, std::unique_ptr<Chunk>> pending;
+    std::size_t nextIndex = 0;
+    while (auto chunk = writeQueue.Pop()) {
+        pending.emplace((*chunk)->index, std::move(*chunk));
+        for (auto it = pending.find(nextIndex); it != pending.end(); it = pending.find(++nextIndex)) {
+            const auto& ready = *it->second;
+            output.Write(ready.output);
+            if (diff)
+                for (auto i : ready.changed)
+                    *diff << ready.output[i].gameId << "," << ready.output[i].bowlerId << ","
+                          << ready.records[i].storedScore << "," << ready.output[i].storedScore << "\n";
+            written += ready.output.size();
+            changed += ready.changed.size();
+            invalid += ready.invalid;
+            pending.erase(it);
+            inFlight.release();
+        }
+    }
+
+    for (auto& i : threads)
+        i.join();
+    if (reporter.joinable()) {
+        {
+            std::lock_guard lock{progressMutex};
+            finished = true;
+        }
+        progressWake.notify_all();
+        reporter.join();
+    }
+    return Snapshot();
+}
@@ -0,0 +1,25 @@
+#include "ResourceAllocated.h"
+
+void* ResourceAllocated::operator new(std::size_t size) {
+    return operator new(size, std::pmr::new_delete_resource());
+}
+
+void* ResourceAllocated::operator new(std::size_t size, std::pmr::memory_resource* resource) {
+    static_assert(sizeof(Header) <= headerSize);
+    const auto total = AllocationSize(size);
+    auto* block = static_cast<std::byte*>(resource->allocate(total, headerSize));
+    ::new (block) Header{resource, total};
+    return block + headerSize;
+}
+
+void ResourceAllocated::Deallocate(void* p) {
+    if (!p)
+        return;
+    auto* block = static_cast<std::byte*>(p) - headerSize;
+    const auto header = *reinterpret_cast<Header*>(block);
+    header.resource->deallocate(block, header.size, headerSize);
+}
+
+void ResourceAllocated::operator delete(void* p, std::pmr::memory_resource*) {
+    Deallocate(p);
+}
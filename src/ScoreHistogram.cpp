@@ -0,0 +1,195 @@
+#include "ScoreHistogram.h"
+
+#include "LittleEndian.h"
+
+#include <algorithm>
+#include <cmath>
+#include <istream>
+#include <numeric>
+#include <ostream>
+
+namespace {
+    using ::LittleEndian;
+
+    ScoreHistogramHeader LittleEndian(ScoreHistogramHeader header) {
+        header.version = LittleEndian(header.version);
+        header.bins = LittleEndian(header.bins);
+        header.frames = LittleEndian(header.frames);
+        header.bowlers = LittleEndian(header.bowlers);
+        return header;
+    }
+}
+
+void Histogram::Merge(const Histogram& other) {
+    for (std::size_t i = 0; i < bins; ++i)
+        counts[i] += other.counts[i];
+}
+
+uint64_t Histogram::Total() const {
+    return std::accumulate(counts.begin(), counts.end(), uint64_t{0});
+}
+
+double Histogram::Mean() const {
+    const auto total = Total();
+    if (!total)
+        return 0;
+    double sum = 0;
+    for (std::size_t i = 0; i < bins; ++i)
+        sum += static_cast<double>(i) * counts[i];
+    return sum / total;
+}
+
+uint_fast16_t Histogram::Percentile(double p) const {
+    if (!(p >= 0 && p <= 1))
+        throw std::invalid_argument{"Percentile must be between 0 and 1"};
+    const auto total = Total();
+    if (!total)
+        return 0;
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p * total)));
+    uint64_t seen = 0;
+    for (std::size_t i = 0; i < bins; ++i)
+        if ((seen += counts[i]) >= rank)
+            return static_cast<uint_fast16_t>(i);
+    return bins - 1;
+}
+
+ScoreHistogram::ScoreHistogram(Options options)
+        : frames(options.perFrame ? 10 : 0), bowlers(options.bowlers) {
+}
+
+void ScoreHistogram::Add(uint_fast16_t score, uint32_t bowler) {
+    games.Add(score);
+    if (bowler < bowlers.size())
+        bowlers[bowler].Add(score);
+}
+
+void ScoreHistogram::Merge(const ScoreHistogram& other) {
+    if (frames.size() != other.frames.size() || bowlers.size() != other.bowlers.size())
+        throw ScoreHistogramException{"Cannot merge histograms with different frames or bowlers"};
+    games.Merge(other.games);
+    for (std::size_t i = 0; i < frames.size(); ++i)
+        frames[i].Merge(other.frames[i]);
+    for (std::size_t i = 0; i < bowlers.size(); ++i)
+        bowlers[i].Merge(other.bowlers[i]);
+}
+
+void ScoreHistogram::Clear() {
+    games = {};
+    std::fill(frames.begin(), frames.end(), Histogram{});
+    std::fill(bowlers.begin(), bowlers.end(), Histogram{});
+}
+
+const Histogram& ScoreHistogram::Games() const {
+    return games;
+}
+
+bool ScoreHistogram::PerFrame() const {
+    return !frames.empty();
+}
+
+const Histogram& ScoreHistogram::Frame(uint_fast8_t frame) const {
+    return frames.at(frame);
+}
+
+uint32_t ScoreHistogram::Bowlers() const {
+    return static_cast<uint32_t>(bowlers.size());
+}
+
+const Histogram& ScoreHistogram::Bowler(uint32_t bowler) const {
+    return bowlers.at(bowler);
+}
+
+void ScoreHistogram::WriteCsv(std::ostream& out) const {
+    out << "score,games";
+    for (std::size_t i = 0; i < frames.size(); ++i)
+        out << ",frame" << i + 1;
+    for (std::size_t i = 0; i < bowlers.size(); ++i)
+        out << ",bowler" << i;
+    out << '\n';
+    for (std::size_t score = 0; score < Histogram::bins; ++score) {
+        out << score << ',' << games.counts[score];
+        for (const auto& i : frames)
+            out << ',' << i.counts[score];
+        for (const auto& i : bowlers)
+            out << ',' << i.counts[score];
+        out << '\n';
+    }
+}
+
+void ScoreHistogram::Save(std::ostream& out) const {
+    ScoreHistogramHeader header;
+    header.frames = static_cast<uint16_t>(frames.size());
+    header.bowlers = static_cast<uint32_t>(bowlers.size());
+    header = LittleEndian(header);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    const auto write = [&](const Histogram& histogram) {
+        auto counts = histogram.counts;
+        for (auto& i : counts)
+            i = LittleEndian(i);
+        out.write(reinterpret_cast<const char*>(counts.data()), sizeof(counts));
+    };
+    write(games);
+    std::for_each(frames.begin(), frames.end(), write);
+    std::for_each(bowlers.begin(), bowlers.end(), write);
+    if (!out.flush())
+        throw ScoreHistogramException{"Cannot write score histogram"};
+}
+
+ScoreHistogram ScoreHistogram::Load(std::istream& in) {
+    ScoreHistogramHeader header;
+    in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    header = LittleEndian(header);
+    if (!in || header.magic != ScoreHistogramHeader::expectedMagic)
+        throw ScoreHistogramException{"Not a score histogram"};
+    if (header.version != ScoreHistogramHeader::currentVersion || header.bins != Histogram::bins ||
+        (header.frames != 0 && header.frames != 10))
+        throw ScoreHistogramException{"Unsupported score histogram version or layout"};
+    // The bowler count is only trusted as far as the stream holds that many histograms,
+    // so a corrupt header cannot allocate more than the file could fill. Streams that
+    // cannot seek are read a bowler at a time instead.
+    const auto histograms = 1 + header.frames + uint64_t{header.bowlers};
+    const auto start = in.tellg();
+    if (start != -1 && in.seekg(0, std::ios::end)) {
+        const auto size = static_cast<uint64_t>(in.tellg() - start);
+        in.seekg(start);
+        if (size < histograms * sizeof(Histogram::counts))
+            throw ScoreHistogramException{"Score histogram is truncated"};
+    }
+    in.clear();
+    ScoreHistogram result{{header.frames != 0, 0}};
+    const auto read = [&](Histogram& histogram) {
+        if (!in.read(reinterpret_cast<char*>(histogram.counts.data()), sizeof(histogram.counts)))
+            throw ScoreHistogramException{"Score histogram is truncated"};
+        for (auto& i : histogram.counts)
+            i = LittleEndian(i);
+    };
+    read(result.games);
+    std::for_each(result.frames.begin(), result.frames.end(), read);
+    for (uint32_t i = 0; i < header.bowlers; ++i)
+        read(result.bowlers.emplace_back());
+    return result;
+}
+
+ScoreCollector::ScoreCollector(unsigned threads, ScoreHistogram::Options options)
+        : options{options}, shards(std::max(1u, threads), ScoreHistogram{options}) {
+}
+
+unsigned ScoreCollector::Threads() const {
+    return static_cast<unsigned>(shards.size());
+}
+
+ScoreHistogram& ScoreCollector::Shard(unsigned thread) {
+    return shards.at(thread);
+}
+
+ScoreHistogram ScoreCollector::Merge() const {
+    ScoreHistogram result{options};
+    for (const auto& shard : shards)
+        result.Merge(shard);
+    return result;
+}
+
+void ScoreCollector::Clear() {
+    for (auto& shard : shards)
+        shard.Clear();
+}
@@ -0,0 +1,190 @@
+#include "ShardCoordinator.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+    std::string Error(const std::string& what) {
+        return what + ": " + std::strerror(errno);
+    }
+
+    // An anonymous shared mapping holding one ShardSlot, inherited by every worker
+    // forked after it.
+    class Segment {
+        void* memory;
+
+    public:
+        Segment() : memory{mmap(nullptr, sizeof(ShardSlot), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0)} {
+            if (memory == MAP_FAILED)
+                throw ShardCoordinatorException{Error("Cannot map a shard segment")};
+            new (memory) ShardSlot{};
+        }
+
+        ~Segment() {
+            Slot().~ShardSlot();
+            munmap(memory, sizeof(ShardSlot));
+        }
+
+        Segment(const Segment&) = delete;
+
+        Segment& operator=(const Segment&) = delete;
+
+        ShardSlot& Slot() {
+            return *static_cast<ShardSlot*>(memory);
+        }
+    };
+
+    // Worker pids by shard, 0 once reaped. Whatever is still running when Run
+    // leaves early is killed and reaped.
+    class Workers {
+    public:
+        std::vector<pid_t> pids;
+
+        explicit Workers(std::size_t shards) : pids(shards) {
+        }
+
+        ~Workers() {
+            for (auto pid : pids)
+                if (pid > 0)
+                    kill(pid, SIGKILL);
+            for (auto pid : pids)
+                if (pid > 0)
+                    waitpid(pid, nullptr, 0);
+        }
+
+        Workers(const Workers&) = delete;
+
+        Workers& operator=(const Workers&) = delete;
+    };
+}
+
+unsigned ShardResults::Restarts() const {
+    unsigned result = 0;
+    for (const auto& shard : shards)
+        result += shard.restarts;
+    return result;
+}
+
+ShardCoordinator::ShardCoordinator(const Simulation& simulation, Options options, ChunkHook hook)
+        : simulation{simulation}, options{options}, hook{std::move(hook)} {
+    if (!options.workers || !options.chunkGames)
+        throw std::invalid_argument{"A shard coordinator needs at least one worker and one game per chunk"};
+}
+
+uint64_t ShardCoordinator::Chunks() const {
+    return (options.games + options.chunkGames - 1) / options.chunkGames;
+}
+
+std::mt19937_64 ShardCoordinator::ChunkRng(uint64_t seed, uint64_t chunk) {
+    std::seed_seq sequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32),
+                           static_cast<uint32_t>(chunk), static_cast<uint32_t>(chunk >> 32)};
+    return std::mt19937_64{sequence};
+}
+
+void ShardCoordinator::Work(ShardSlot& slot, unsigned shard, const ShardReport& report, unsigned attempt) const {
+    for (auto done = slot.committed.load(std::memory_order_acquire); done < report.chunks; ++done) {
+        auto next = slot.checkpoints[done % 2];
+        const auto chunk = report.firstChunk + done;
+        if (hook)
+            hook(shard, chunk, attempt);
+        auto rng = ChunkRng(options.seed, chunk);
+        const auto games = std::min(options.chunkGames, options.games - chunk * options.chunkGames);
+        simulation.Play(options.engine, games, rng, [&](uint_fast16_t score) {
+            next.totals.Add(score);
+            next.histogram.Add(score);
+        });
+        next.chunks = done + 1;
+        slot.checkpoints[(done + 1) % 2] = next;
+        slot.committed.store(done + 1, std::memory_order_release);
+    }
+}
+
+ShardResults ShardCoordinator::Run() const {
+    const auto chunks = Chunks();
+    const auto shards = static_cast<unsigned>(std::min<uint64_t>(options.workers, chunks));
+    ShardResults results;
+    results.shards.resize(shards);
+    std::vector<std::unique_ptr<Segment>> segments;
+    for (unsigned shard = 0; shard < shards; ++shard) {
+        auto& report = results.shards[shard];
+        report.firstChunk = chunks * shard / shards;
+        report.chunks = chunks * (shard + 1) / shards - report.firstChunk;
+        segments.push_back(std::make_unique<Segment>());
+    }
+
+    Workers workers{shards};
+    const auto parent = getpid();
+    const auto start = [&](unsigned shard) {
+        // Anything still buffered would otherwise be written again by the worker.
+        std::fflush(nullptr);
+        const auto pid = fork();
+        if (pid < 0)
+            throw ShardCoordinatorException{Error("Cannot fork a worker")};
+        if (pid == 0) {
+            // If the coordinator died before the signal was armed, it never will be sent.
+            if (prctl(PR_SET_PDEATHSIG, SIGKILL) != 0 || getppid() != parent)
+                _exit(1);
+            try {
+                Work(segments[shard]->Slot(), shard, results.shards[shard], results.shards[shard].restarts);
+            } catch (...) {
+                _exit(1);
+            }
+            _exit(0);
+        }
+        workers.pids[shard] = pid;
+    };
+    for (unsigned shard = 0; shard < shards; ++shard)
+        start(shard);
+
+    // Polls the workers' own pids, so other children of this process are left to
+    // whoever started them.
+    for (auto running = shards; running;) {
+        int status = 0;
+        unsigned shard = 0;
+        for (; shard < shards; ++shard) {
+            if (workers.pids[shard] <= 0)
+                continue;
+            const auto pid = waitpid(workers.pids[shard], &status, WNOHANG);
+            if (pid < 0 && errno != EINTR)
+                throw ShardCoordinatorException{Error("Cannot wait for workers")};
+            if (pid > 0)
+                break;
+        }
+        if (shard == shards) {
+            usleep(1'000);
+            continue;
+        }
+        workers.pids[shard] = 0;
+        auto& report = results.shards[shard];
+        const auto finished = WIFEXITED(status) && WEXITSTATUS(status) == 0 &&
+                              segments[shard]->Slot().committed.load(std::memory_order_acquire) == report.chunks;
+        if (finished) {
+            --running;
+            continue;
+        }
+        if (report.restarts == options.maxRestarts)
+            throw ShardCoordinatorException{"Shard " + std::to_string(shard) + " died " +
+                                            std::to_string(report.restarts + 1) + " times"};
+        ++report.restarts;
+        start(shard);
+    }
+
+    for (auto& segment : segments) {
+        const auto& checkpoint = segment->Slot().Committed();
+        results.totals.Merge(checkpoint.totals);
+        results.histogram.Merge(checkpoint.histogram);
+    }
+    return results;
+}
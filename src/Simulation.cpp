@@ -0,0 +1,42 @@
+#include "Simulation.h"
+
+void SimulationTotals::Merge(const SimulationTotals& other) {
+    games += other.games;
+    total += other.total;
+    best = std::max(best, other.best);
+}
+
+double SimulationTotals::Average() const {
+    return games ? static_cast<double>(total) / games : 0.0;
+}
+
+Simulation::Simulation(const SkillModel* model, uint32_t bowlerId)
+        : model{model}, bowler{model ? model->Find(bowlerId) : SkillRecord{}} {
+}
+
+const char* Simulation::Name(SimulationEngine engine) {
+    switch (engine) {
+        case SimulationEngine::HEAP:
+            return "FrameSet on the heap";
+        case SimulationEngine::ARENA:
+            return "FrameSet on a GameArena";
+        case SimulationEngine::INLINE:
+            return "InlineFrameSet";
+    }
+    return "unknown";
+}
+
+PinSet Simulation::RandomBall(std::mt19937_64& rng, uint_fast64_t& pinsDown) {
+    pinsDown = rng() % 11;
+    PinSet pins;
+    for (uint_fast64_t i = 0; i < pinsDown; ++i) {
+        pins.KnockDownPin(static_cast<Pin>(i));
+    }
+    return pins;
+}
+
+SimulationTotals Simulation::Play(SimulationEngine engine, uint_fast64_t games, std::mt19937_64& rng) const {
+    SimulationTotals totals;
+    Play(engine, games, rng, [&](uint_fast16_t score) { totals.Add(score); });
+    return totals;
+}
@@ -0,0 +1,296 @@
+#include "SkillModel.h"
+
+#include <algorithm>
+#include <bit>
+#include <fstream>
+#include <unordered_map>
+
+namespace {
+    struct Counts {
+        uint64_t games = 0;
+        std::array<uint64_t, 11> firstBall{};
+        std::array<uint64_t, 6> attempts{};
+        std::array<uint64_t, 6> conversions{};
+        uint64_t missedPins = 0;
+        uint64_t missedPinsDown = 0;
+
+        void Add(const Counts& other) {
+            games += other.games;
+            for (std::size_t i = 0; i < firstBall.size(); ++i)
+                firstBall[i] += other.firstBall[i];
+            for (std::size_t i = 0; i < attempts.size(); ++i) {
+                attempts[i] += other.attempts[i];
+                conversions[i] += other.conversions[i];
+            }
+            missedPins += other.missedPins;
+            missedPinsDown += other.missedPinsDown;
+        }
+    };
+
+    struct Shard {
+        std::unordered_map<uint32_t, Counts> bowlers;
+        std::array<uint64_t, 1024> leaves{};
+        uint64_t games = 0;
+    };
+
+    uint16_t FixedPoint(uint64_t numerator, uint64_t denominator) {
+        if (!denominator)
+            return 0;
+        return static_cast<uint16_t>(std::min<uint64_t>(numerator * 65536 / denominator, 65535));
+    }
+
+    // Walks one game's balls through the frames. Returns false, leaving the counts
+    // untouched, unless the game is legal and ends exactly on its last ball. Any ball
+    // at a full rack counts as a first ball, as Sample draws it.
+    bool Count(const ArchiveRecord& record, Counts& counts, std::array<uint64_t, 1024>& leaves) {
+        if (record.ballCount == 0 || record.ballCount > 21)
+            return false;
+        struct FirstBall { uint8_t pinsDown; uint16_t leave; };
+        struct SecondBall { uint8_t type; uint8_t pinsUp; uint16_t after; };
+        std::array<FirstBall, 21> firsts{};
+        std::array<SecondBall, 21> seconds{};
+        std::size_t firstCount = 0, secondCount = 0, ball = 0;
+
+        const auto bowl = [&](uint16_t standing) -> int {
+            if (ball == record.ballCount)
+                return -1;
+            const uint16_t after = record.balls[ball++] & 0x3FF;
+            if (after & ~standing)
+                return -1;
+            if (standing == SkillModel::fullRack)
+                firsts[firstCount++] = {static_cast<uint8_t>(10 - std::popcount(after)), after};
+            else
+                seconds[secondCount++] = {static_cast<uint8_t>(LeaveClassifier::Classify(standing).type),
+                                          static_cast<uint8_t>(std::popcount(standing)), after};
+            return after;
+        };
+
+        for (auto frame = 0; frame < 9; ++frame) {
+            const auto first = bowl(SkillModel::fullRack);
+            if (first < 0 || (first && bowl(first) < 0))
+                return false;
+        }
+        const auto first = bowl(SkillModel::fullRack);
+        if (first < 0)
+            return false;
+        const auto second = bowl(first ? first : SkillModel::fullRack);
+        if (second < 0)
+            return false;
+        if ((!first || !second) && bowl(second ? second : SkillModel::fullRack) < 0)
+            return false;
+        if (ball != record.ballCount)
+            return false;
+
+        ++counts.games;
+        for (std::size_t i = 0; i < firstCount; ++i) {
+            ++counts.firstBall[firsts[i].pinsDown];
+            ++leaves[firsts[i].leave];
+        }
+        for (std::size_t i = 0; i < secondCount; ++i) {
+            const auto& shot = seconds[i];
+            ++counts.attempts[shot.type];
+            if (!shot.after) {
+                ++counts.conversions[shot.type];
+            } else {
+                counts.missedPins += shot.pinsUp;
+                counts.missedPinsDown += shot.pinsUp - std::popcount(shot.after);
+            }
+        }
+        return true;
+    }
+
+    SkillRecord ToRecord(uint32_t bowlerId, const Counts& counts) {
+        SkillRecord record;
+        record.bowlerId = bowlerId;
+        record.games = static_cast<uint32_t>(std::min<uint64_t>(counts.games, UINT32_MAX));
+        uint64_t firstBalls = 0, cumulative = 0;
+        for (auto i : counts.firstBall)
+            firstBalls += i;
+        for (std::size_t i = 0; i < counts.firstBall.size(); ++i) {
+            cumulative += counts.firstBall[i];
+            record.firstBall[i] = FixedPoint(cumulative, firstBalls);
+        }
+        for (std::size_t i = 0; i < counts.attempts.size(); ++i)
+            record.conversion[i] = FixedPoint(counts.conversions[i], counts.attempts[i]);
+        record.pinHit = FixedPoint(counts.missedPinsDown, counts.missedPins);
+        return record;
+    }
+}
+
+SkillModel SkillModel::Fit(std::span<const ArchiveRecord> records, unsigned threads) {
+    threads = std::max(1u, std::min<unsigned>(threads, std::max<std::size_t>(records.size() / 4096, 1)));
+    std::vector<Shard> shards(threads);
+    const auto chunk = (records.size() + threads - 1) / threads;
+    const auto fit = [&](unsigned t) {
+        auto& shard = shards[t];
+        const auto begin = std::min(records.size(), t * chunk);
+        const auto end = std::min(records.size(), begin + chunk);
+        // Bowlers come in runs in most archives, so keep the last one's counts at hand.
+        uint32_t lastId = 0;
+        Counts* last = nullptr;
+        for (auto i = begin; i < end; ++i) {
+            const auto& record = records[i];
+            if (!last || record.bowlerId != lastId) {
+                lastId = record.bowlerId;
+                last = &shard.bowlers[lastId];
+            }
+            shard.games += Count(record, *last, shard.leaves);
+        }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t)
+        workers.emplace_back(fit, t);
+    fit(0);
+    for (auto& i : workers)
+        i.join();
+
+    std::unordered_map<uint32_t, Counts> bowlers;
+    Counts pooled;
+    SkillModel model;
+    for (const auto& shard : shards) {
+        for (const auto& [id, counts] : shard.bowlers) {
+            bowlers[id].Add(counts);
+            pooled.Add(counts);
+        }
+        for (std::size_t i = 0; i < shard.leaves.size(); ++i)
+            model.leaveCounts[i] += static_cast<uint32_t>(std::min<uint64_t>(shard.leaves[i], UINT32_MAX - model.leaveCounts[i]));
+        model.header.gamesFitted += shard.games;
+    }
+    for (const auto& [id, counts] : bowlers)
+        if (counts.games)
+            model.bowlers.push_back(ToRecord(id, counts));
+    std::sort(model.bowlers.begin(), model.bowlers.end(),
+              [](const SkillRecord& lhs, const SkillRecord& rhs) { return lhs.bowlerId < rhs.bowlerId; });
+    model.pooled = ToRecord(SkillRecord::pooledId, pooled);
+    model.header.bowlerCount = static_cast<uint32_t>(model.bowlers.size());
+    model.BuildLeaves();
+    return model;
+}
+
+SkillModel SkillModel::Load(const std::string& path) {
+    std::ifstream in{path, std::ios::binary};
+    if (!in)
+        throw SkillModelException{"Cannot open " + path};
+    SkillModel model;
+    in.read(reinterpret_cast<char*>(&model.header), sizeof(model.header));
+    if (!in || model.header.magic != SkillModelHeader::expectedMagic)
+        throw SkillModelException{path + " is not a skill model"};
+    if (model.header.version != SkillModelHeader::currentVersion || model.header.recordSize != sizeof(SkillRecord))
+        throw SkillModelException{path + " has an unsupported version or record size"};
+    // The bowler count is only trusted as far as the file holds that many records, so
+    // a corrupt header cannot allocate more than the file could fill.
+    const auto start = in.tellg();
+    in.seekg(0, std::ios::end);
+    const auto size = static_cast<uint64_t>(in.tellg() - start);
+    in.seekg(start);
+    if (size < sizeof(model.leaveCounts) + sizeof(model.pooled) + uint64_t{model.header.bowlerCount} * sizeof(SkillRecord))
+        throw SkillModelException{path + " is truncated"};
+    model.bowlers.resize(model.header.bowlerCount);
+    in.read(reinterpret_cast<char*>(model.leaveCounts.data()), sizeof(model.leaveCounts));
+    in.read(reinterpret_cast<char*>(&model.pooled), sizeof(model.pooled));
+    in.read(reinterpret_cast<char*>(model.bowlers.data()), model.bowlers.size() * sizeof(SkillRecord));
+    if (!in)
+        throw SkillModelException{path + " is truncated"};
+    // Find looks bowlers up by binary search.
+    if (std::adjacent_find(model.bowlers.begin(), model.bowlers.end(), [](const SkillRecord& a, const SkillRecord& b) {
+            return a.bowlerId >= b.bowlerId;
+        }) != model.bowlers.end())
+        throw SkillModelException{path + " has bowlers out of order"};
+    model.BuildLeaves();
+    return model;
+}
+
+void SkillModel::Save(const std::string& path) const {
+    std::ofstream out{path, std::ios::binary | std::ios::trunc};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(leaveCounts.data()), sizeof(leaveCounts));
+    out.write(reinterpret_cast<const char*>(&pooled), sizeof(pooled));
+    out.write(reinterpret_cast<const char*>(bowlers.data()), bowlers.size() * sizeof(SkillRecord));
+    if (!out.flush())
+        throw SkillModelException{"Cannot write " + path};
+}
+
+uint64_t SkillModel::GamesFitted() const {
+    return header.gamesFitted;
+}
+
+std::span<const SkillRecord> SkillModel::Bowlers() const {
+    return bowlers;
+}
+
+const SkillRecord& SkillModel::Pooled() const {
+    return pooled;
+}
+
+const SkillRecord& SkillModel::Find(uint32_t bowlerId) const {
+    const auto found = std::lower_bound(bowlers.begin(), bowlers.end(), bowlerId,
+                                        [](const SkillRecord& record, uint32_t id) { return record.bowlerId < id; });
+    return found != bowlers.end() && found->bowlerId == bowlerId ? *found : pooled;
+}
+
+std::array<double, 11> SkillModel::Pinfall(const SkillRecord& bowler, uint_fast8_t standing) const {
+    std::array<double, 11> result{};
+    if (standing == 10) {
+        uint16_t previous = 0;
+        for (auto i = 0; i < 10; ++i) {
+            result[i] = std::max(bowler.firstBall[i], previous) - previous;
+            previous = std::max(bowler.firstBall[i], previous);
+        }
+        result[10] = 65536 - previous;
+        for (auto& i : result)
+            i /= 65536;
+        return result;
+    }
+
+    // A missed pin stays up when its 6 random bits, shifted up by 10, reach pinHit.
+    const auto stays = 1 - std::min(64, (bowler.pinHit + 1023) / 1024) / 64.0;
+    std::array<double, 11> miss{};
+    miss[0] = 1;
+    for (auto pin = 0; pin < standing; ++pin)
+        for (auto down = pin + 1; down >= 0; --down)
+            miss[down] = miss[down] * stays + (down ? miss[down - 1] * (1 - stays) : 0);
+    miss[standing - 1] += miss[standing];
+    miss[standing] = 0;
+
+    const auto& group = leaves[10 - standing];
+    uint64_t previous = 0;
+    double convert = 0;
+    for (const auto& leave : group) {
+        const auto type = static_cast<std::size_t>(LeaveClassifier::Classify(leave.standing).type);
+        convert += (leave.cumulative - previous) * (bowler.conversion[type] / 65536.0);
+        previous = leave.cumulative;
+    }
+    // No archived leave of this size: SampleLeave leaves the highest numbered pins.
+    if (previous) {
+        convert /= previous;
+    } else {
+        const auto leave = LeaveClassifier::Classify(fullRack & ~((1u << (10 - standing)) - 1));
+        convert = bowler.conversion[static_cast<std::size_t>(leave.type)] / 65536.0;
+    }
+    for (auto down = 0; down < standing; ++down)
+        result[down] = (1 - convert) * miss[down];
+    result[standing] = convert;
+    return result;
+}
+
+void SkillModel::BuildLeaves() {
+    for (auto& i : leaves)
+        i.clear();
+    for (uint16_t standing = 0; standing < leaveCounts.size(); ++standing) {
+        auto& group = leaves[10 - std::popcount(standing)];
+        const uint64_t previous = group.empty() ? 0 : group.back().cumulative;
+        if (leaveCounts[standing])
+            group.push_back({standing, previous + leaveCounts[standing]});
+    }
+}
+
+uint16_t SkillModel::SampleLeave(uint_fast8_t pinsDown, uint32_t random) const {
+    const auto& group = leaves[pinsDown];
+    // No archived first ball knocked down this many: take the lowest numbered pins.
+    if (group.empty())
+        return static_cast<uint16_t>(fullRack & ~((1u << pinsDown) - 1));
+    const auto target = static_cast<uint64_t>(random * 0x1p-32 * group.back().cumulative);
+    return std::upper_bound(group.begin(), group.end(), target,
+                            [](uint64_t value, const Leave& leave) { return value < leave.cumulative; })->standing;
+}
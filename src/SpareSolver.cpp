@@ -0,0 +1,121 @@
+#include "SpareSolver.h"
+
+#include <algorithm>
+#include <bitset>
+#include <stdexcept>
+
+static constexpr uint_fast16_t fullRack = 0b11'11'11'11'11;
+static constexpr uint8_t noTarget = 0xFF;
+
+SpareSolver::SpareSolver(const IAccuracyModel& model) : values(tableSize, 0), policy(tableSize, noTarget) {
+    for (std::size_t mask = 0; mask < masks; ++mask)
+        for (auto pin = 0; pin < 10; ++pin) {
+            if (!(mask & (std::size_t{1} << pin)))
+                continue;
+            auto& shots = outcomes[mask * 10 + pin];
+            shots = model.Outcomes(mask, static_cast<Pin>(pin));
+            for (auto& i : shots)
+                i.standing &= mask;
+        }
+}
+
+std::size_t SpareSolver::Index(const State& state) {
+    const std::size_t bonus = (state.bonusNext * 2 + state.bonusAfter) * 2 + state.struck;
+    return ((state.frame * 3 + state.ball) * bonusStates + bonus) * masks + state.standing;
+}
+
+SpareSolver::State SpareSolver::Next(const State& state, uint_fast16_t after, bool& ended) {
+    const bool cleared = after == 0;
+    ended = false;
+    if (state.frame < 9) {
+        if (state.ball == 0 && !cleared)
+            return {state.frame, 1, after, state.bonusAfter, 0, false};
+        if (state.ball == 0)
+            return {static_cast<uint_fast8_t>(state.frame + 1), 0, fullRack,
+                    static_cast<uint_fast8_t>(state.bonusAfter + 1), 1, false};
+        return {static_cast<uint_fast8_t>(state.frame + 1), 0, fullRack, cleared, 0, false};
+    }
+    switch (state.ball) {
+        case 0:
+            return {9, 1, cleared ? fullRack : after, state.bonusAfter, 0, cleared};
+        case 1:
+            if (state.struck || cleared)
+                return {9, 2, cleared ? fullRack : after, 0, 0, false};
+            [[fallthrough]];
+        default:
+            ended = true;
+            return {};
+    }
+}
+
+double SpareSolver::Value(const State& state) const {
+    return values[Index(state)];
+}
+
+void SpareSolver::SolveState(const State& state) {
+    const auto standingBefore = std::bitset<10>(state.standing).count();
+    auto best = 0.0;
+    auto bestTarget = noTarget;
+    for (auto pin = 0; pin < 10; ++pin) {
+        const auto& shots = outcomes[state.standing * 10 + pin];
+        if (shots.empty())
+            continue;
+        auto expected = 0.0;
+        for (const auto& i : shots) {
+            const auto knocked = standingBefore - std::bitset<10>(i.standing).count();
+            bool ended;
+            const auto next = Next(state, i.standing, ended);
+            expected += i.probability * (knocked * (1 + state.bonusNext) + (ended ? 0.0 : Value(next)));
+        }
+        if (bestTarget == noTarget || expected > best) {
+            best = expected;
+            bestTarget = static_cast<uint8_t>(pin);
+        }
+    }
+    values[Index(state)] = best;
+    policy[Index(state)] = bestTarget;
+}
+
+template <typename F>
+void SpareSolver::ParallelFor(std::size_t count, unsigned threads, F&& fn) {
+    threads = std::max(1u, std::min<unsigned>(threads, count));
+    const auto chunk = (count + threads - 1) / threads;
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t)
+        workers.emplace_back([&fn, t, chunk, count] {
+            for (auto i = t * chunk; i < std::min(count, (t + 1) * chunk); ++i)
+                fn(i);
+        });
+    for (std::size_t i = 0; i < std::min(count, chunk); ++i)
+        fn(i);
+    for (auto& i : workers)
+        i.join();
+}
+
+void SpareSolver::Solve(unsigned threads) {
+    for (auto frame = 9; frame >= 0; --frame)
+        for (auto ball = frame == 9 ? 2 : 1; ball >= 0; --ball)
+            ParallelFor(bonusStates * masks, threads, [this, frame, ball](std::size_t i) {
+                const auto bonus = i / masks;
+                const State state{static_cast<uint_fast8_t>(frame), static_cast<uint_fast8_t>(ball),
+                            static_cast<uint_fast16_t>(i % masks), static_cast<uint_fast8_t>(bonus / 4),
+                            static_cast<uint_fast8_t>(bonus / 2 % 2), static_cast<bool>(bonus % 2)};
+                SolveState(state);
+            });
+}
+
+double SpareSolver::ExpectedScore() const {
+    return Value(State{});
+}
+
+double SpareSolver::ExpectedScore(const State& state) const {
+    return Value(state);
+}
+
+Pin SpareSolver::BestTarget(const State& state) const {
+    const auto target = policy[Index(state)];
+    if (target == noTarget)
+        throw std::invalid_argument{"No pins are standing in this state"};
+    return static_cast<Pin>(target);
+}
@@ -0,0 +1,249 @@
+#include "Sweep.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <ostream>
+#include <random>
+#include <sstream>
+
+namespace {
+    using Pinfall = BallModel::Pinfall;
+
+    // Bumped whenever a result would come out differently for the same key.
+    constexpr uint64_t keyVersion = 1;
+
+    class KeyHash {
+        uint64_t state = 0xCBF2'9CE4'8422'2325;
+
+    public:
+        template <typename T>
+        void Add(const T& value) {
+            unsigned char bytes[sizeof(T)];
+            std::memcpy(bytes, &value, sizeof(T));
+            for (auto i : bytes)
+                state = (state ^ i) * 0x100'0000'01B3;
+        }
+
+        uint64_t Value() const {
+            return state;
+        }
+    };
+
+    // Sets the chance of knocking down all standing pins, keeping the others in proportion.
+    void Tilt(Pinfall& pinfall, uint_fast8_t standing, double clear) {
+        clear = std::clamp(clear, 0.0, 1.0);
+        const auto rest = 1 - pinfall[standing];
+        for (uint_fast8_t pins = 0; pins < standing; ++pins)
+            pinfall[pins] = rest > 0 ? pinfall[pins] * (1 - clear) / rest : (1 - clear) / standing;
+        pinfall[standing] = clear;
+    }
+
+    // Nearest rank, as Histogram::Percentile.
+    uint_fast16_t Percentile(const Sweep::Distribution& distribution, double p) {
+        double below = 0;
+        for (std::size_t score = 0; score < distribution.size(); ++score)
+            if ((below += distribution[score]) >= p * (1 - 1e-12))
+                return static_cast<uint_fast16_t>(score);
+        return static_cast<uint_fast16_t>(distribution.size() - 1);
+    }
+}
+
+std::vector<SweepPoint> SweepGrid::Points() const {
+    std::vector<SweepPoint> points;
+    for (auto strike : strikeDeltas)
+        for (auto spare : spareDeltas)
+            for (bool bonus : tenthFrameBonus)
+                points.push_back({strike, spare, {bonus}});
+    return points;
+}
+
+SweepCache SweepCache::Load(const std::string& path) {
+    SweepCache cache;
+    std::ifstream in{path};
+    if (!in)
+        return cache;
+    std::string line;
+    std::getline(in, line);
+    while (std::getline(in, line)) {
+        if (line.empty())
+            continue;
+        std::istringstream row{line};
+        std::vector<std::string> fields;
+        for (std::string field; std::getline(row, field, ',');)
+            fields.push_back(field);
+        if (fields.size() != 9)
+            throw SweepException{path + ": expected 9 fields in \"" + line + "\""};
+        SweepResult result;
+        try {
+            result.point.strikeDelta = std::stod(fields[0]);
+            result.point.spareDelta = std::stod(fields[1]);
+            result.point.rules.tenthFrameBonus = std::stoi(fields[2]) != 0;
+            result.mean = std::stod(fields[3]);
+            result.standardDeviation = std::stod(fields[4]);
+            result.median = std::stoul(fields[5]);
+            result.percentile99 = std::stoul(fields[6]);
+            result.atLeast200 = std::stod(fields[7]);
+            result.key = std::stoull(fields[8], nullptr, 16);
+        } catch (const std::logic_error&) {
+            throw SweepException{path + ": cannot read \"" + line + "\""};
+        }
+        cache.Insert(result);
+    }
+    return cache;
+}
+
+void SweepCache::Save(const std::string& path) const {
+    std::ofstream out{path};
+    if (!out)
+        throw SweepException{"Cannot create " + path};
+    std::vector<SweepResult> rows;
+    for (const auto& [key, result] : results)
+        rows.push_back(result);
+    out << std::setprecision(std::numeric_limits<double>::max_digits10);
+    Sweep::WriteTable(out, rows);
+    if (!out)
+        throw SweepException{"Failed writing " + path};
+}
+
+std::size_t SweepCache::Size() const {
+    return results.size();
+}
+
+const SweepResult* SweepCache::Find(uint64_t key) const {
+    const auto found = results.find(key);
+    return found == results.end() ? nullptr : &found->second;
+}
+
+void SweepCache::Insert(const SweepResult& result) {
+    auto& stored = results[result.key] = result;
+    stored.cached = false;
+}
+
+Sweep::Sweep() = default;
+
+Sweep::Sweep(const SkillModel& model, const SkillRecord& bowler) : base{model, bowler} {
+}
+
+BallModel Sweep::Adjusted(const SweepPoint& point) const {
+    auto result = base.Pinfalls();
+    for (uint_fast8_t standing = 1; standing <= 10; ++standing) {
+        const auto delta = standing == 10 ? point.strikeDelta : point.spareDelta;
+        if (delta != 0)
+            Tilt(result[standing], standing, result[standing][standing] + delta);
+    }
+    return BallModel{result};
+}
+
+Sweep::Distribution Sweep::Simulated(const GameStateSpace& space, const BallModel& balls,
+                                     const Options& options) const {
+    // Every point draws from the same seed, so neighbouring points differ by their
+    // parameters more than by their luck.
+    const auto cumulative = balls.Cumulative();
+    std::mt19937_64 rng{options.seed};
+    std::vector<uint64_t> counts(Distribution{}.size());
+    for (uint64_t game = 0; game < options.games; ++game) {
+        auto state = space.Start();
+        uint_fast16_t score = 0;
+        while (state != space.End()) {
+            const auto pins = BallModel::Draw(cumulative[space.At(state).standing], rng);
+            score += space.Points(state, pins);
+            state = space.Next(state, pins);
+        }
+        ++counts[score];
+    }
+    Distribution result{};
+    for (std::size_t score = 0; score < result.size(); ++score)
+        result[score] = options.games ? static_cast<double>(counts[score]) / options.games : 0;
+    return result;
+}
+
+uint64_t Sweep::Key(const SweepPoint& point, const Options& options) const {
+    KeyHash hash;
+    hash.Add(keyVersion);
+    hash.Add(base.Pinfalls());
+    hash.Add(point.strikeDelta);
+    hash.Add(point.spareDelta);
+    hash.Add(point.rules.tenthFrameBonus);
+    hash.Add(options.method);
+    if (options.method == SweepMethod::SIMULATION) {
+        hash.Add(options.games);
+        hash.Add(options.seed);
+    }
+    return hash.Value();
+}
+
+SweepResult Sweep::Evaluate(const SweepPoint& point, const GameStateSpace& space, const Options& options) const {
+    const auto balls = Adjusted(point);
+    const auto distribution = options.method == SweepMethod::EXACT ? balls.Remaining(space)[space.Start()]
+                                                                    : Simulated(space, balls, options);
+    SweepResult result;
+    result.point = point;
+    result.key = Key(point, options);
+    double squares = 0;
+    for (std::size_t score = 0; score < distribution.size(); ++score) {
+        result.mean += distribution[score] * score;
+        squares += distribution[score] * score * score;
+        if (score >= 200)
+            result.atLeast200 += distribution[score];
+    }
+    result.standardDeviation = std::sqrt(std::max(0.0, squares - result.mean * result.mean));
+    result.median = Percentile(distribution, 0.5);
+    result.percentile99 = Percentile(distribution, 0.99);
+    return result;
+}
+
+SweepResult Sweep::Evaluate(const SweepPoint& point, const Options& options) const {
+    return Evaluate(point, GameStateSpace{point.rules}, options);
+}
+
+std::vector<SweepResult> Sweep::Run(const SweepGrid& grid, const Options& options, SweepCache* cache) const {
+    const auto points = grid.Points();
+    std::vector<SweepResult> results(points.size());
+    std::vector<std::size_t> missing;
+    std::map<GameRules, GameStateSpace> spaces;
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        const auto* found = cache ? cache->Find(Key(points[i], options)) : nullptr;
+        if (found) {
+            results[i] = *found;
+            results[i].point = points[i];
+            results[i].cached = true;
+            continue;
+        }
+        missing.push_back(i);
+        if (!spaces.contains(points[i].rules))
+            spaces.emplace(points[i].rules, GameStateSpace{points[i].rules});
+    }
+
+    std::atomic<std::size_t> next{0};
+    const auto work = [&] {
+        for (auto i = next++; i < missing.size(); i = next++) {
+            const auto& point = points[missing[i]];
+            results[missing[i]] = Evaluate(point, spaces.at(point.rules), options);
+        }
+    };
+    const auto threads = std::clamp<std::size_t>(options.threads, 1, std::max<std::size_t>(missing.size(), 1));
+    std::vector<std::thread> workers;
+    for (std::size_t t = 1; t < threads; ++t)
+        workers.emplace_back(work);
+    work();
+    for (auto& i : workers)
+        i.join();
+
+    if (cache)
+        for (auto i : missing)
+            cache->Insert(results[i]);
+    return results;
+}
+
+void Sweep::WriteTable(std::ostream& out, const std::vector<SweepResult>& results) {
+    out << "strikeDelta,spareDelta,tenthFrameBonus,mean,standardDeviation,median,percentile99,atLeast200,key\n";
+    for (const auto& i : results)
+        out << i.point.strikeDelta << ',' << i.point.spareDelta << ',' << i.point.rules.tenthFrameBonus << ','
+            << i.mean << ',' << i.standardDeviation << ',' << i.median << ',' << i.percentile99 << ','
+            << i.atLeast200 << ',' << std::hex << i.key << std::dec << '\n';
+}
@@ -0,0 +1,55 @@
+#include "WinProbability.h"
+
+#include <stdexcept>
+
+// GameStateTable is generated from the default GameStateSpace, so the two share
+// state IDs and the space's distributions can be indexed by the table's states.
+WinProbability::WinProbability(const SkillModel& model, const SkillRecord& first, const SkillRecord& second) {
+    const GameStateSpace space;
+    players[0].remaining = BallModel{model, first}.Remaining(space);
+    players[1].remaining = &first == &second ? players[0].remaining : BallModel{model, second}.Remaining(space);
+}
+
+void WinProbability::Reset() {
+    for (auto& i : players) {
+        i.state = GameStateTable::start;
+        i.score = 0;
+    }
+}
+
+void WinProbability::Bowled(std::size_t player, uint_fast8_t pins) {
+    auto& bowler = players[player];
+    const auto next = bowler.state == GameStateTable::end || pins > 10 ? GameStateTable::invalid
+                                                                       : GameStateTable::next[bowler.state][pins];
+    if (next == GameStateTable::invalid)
+        throw std::invalid_argument{"That ball is not possible in this state"};
+    bowler.score += GameStateTable::points[bowler.state][pins];
+    bowler.state = next;
+}
+
+uint_fast16_t WinProbability::Score(std::size_t player) const {
+    return players[player].score;
+}
+
+WinProbability::Distribution WinProbability::FinalScore(std::size_t player) const {
+    const auto& bowler = players[player];
+    const auto& remaining = bowler.remaining[bowler.state];
+    Distribution result{};
+    for (std::size_t i = 0; i + bowler.score <= maxPoints; ++i)
+        result[i + bowler.score] = remaining[i];
+    return result;
+}
+
+WinProbability::Odds WinProbability::Current() const {
+    const auto first = FinalScore(0);
+    const auto second = FinalScore(1);
+    Odds odds;
+    double secondBelow = 0;
+    for (std::size_t score = 0; score <= maxPoints; ++score) {
+        odds.first += first[score] * secondBelow;
+        odds.tie += first[score] * second[score];
+        secondBelow += second[score];
+    }
+    odds.second = 1 - odds.first - odds.tie;
+    return odds;
+}
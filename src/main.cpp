@@ -1,27 +1,81 @@
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <random>
+#include <stdexcept>
+#include <string>
 
+#include "AllocationTracker.h"
 #include "FrameSet.h"
-#include "Frame.h"
-#include "FinalFrame.h"
-#include "PinSet.h"
+#include "Simulation.h"
+#include "SkillModel.h"
 
-int main() {
+// Plays many games without output; also the training run for profile-guided builds.
+// With a model, balls are sampled from the bowler's fitted skill instead.
+static int PlayGames(uint_fast64_t games, std::mt19937_64& rng, const SkillModel* model, uint32_t bowlerId) {
+    const auto before = AllocationTracker::ThisThread();
+    const auto totals = Simulation{model, bowlerId}.Play(SimulationEngine::INLINE, games, rng);
+    const auto allocated = AllocationTracker::ThisThread() - before;
+    std::cout << "Games: " << totals.games << "\n";
+    std::cout << "Average Score: " << totals.Average() << "\n";
+    std::cout << "Best Score: " << totals.best << "\n";
+    if (AllocationTracker::Installed() && games) {
+        std::cout << "Allocations: " << allocated.Allocations() << " (" << allocated.Bytes() << " bytes), "
+                  << static_cast<double>(allocated.Bytes()) / games << " bytes per game\n";
+    }
+    return 0;
+}
+
+static int Usage() {
+    std::cerr << "Usage: BowlingSimulator [<games> [<model> <bowler>]]\n";
+    return 2;
+}
+
+// std::stoull skips spaces and negates a leading '-', so "-5" would be a huge count.
+static uint64_t ParseUnsigned(const std::string& text, uint64_t max) {
+    if (text.empty() || text.front() < '0' || text.front() > '9')
+        throw std::invalid_argument{text};
+    std::size_t used = 0;
+    const auto value = std::stoull(text, &used);
+    if (used != text.size())
+        throw std::invalid_argument{text};
+    if (value > max)
+        throw std::out_of_range{text};
+    return value;
+}
+
+int main(int argc, char** argv) {
     std::mt19937_64 rng{std::random_device{}()};
 
-    std::array<std::unique_ptr<IFrame>, 10> frames;
-    for (auto i = 0; i < 9; ++i)
-        frames[i] = std::make_unique<Frame>(std::make_unique<PinSet>());
-    frames.back() = std::make_unique<FinalFrame>(std::make_unique<PinSet>());
-    FrameSet frameSet{std::move(frames)};
+    if (argc == 3 || argc > 4)
+        return Usage();
+    if (argc > 1) {
+        uint_fast64_t games = 0;
+        uint32_t bowlerId = 0;
+        try {
+            games = ParseUnsigned(argv[1], std::numeric_limits<uint_fast64_t>::max());
+            if (argc == 4)
+                bowlerId = static_cast<uint32_t>(ParseUnsigned(argv[3], std::numeric_limits<uint32_t>::max()));
+        } catch (const std::logic_error&) {
+            return Usage();
+        }
+        if (argc == 2)
+            return PlayGames(games, rng, nullptr, 0);
+        try {
+            const auto model = SkillModel::Load(argv[2]);
+            return PlayGames(games, rng, &model, bowlerId);
+        } catch (const SkillModelException& e) {
+            std::cerr << e.what() << "\n";
+            return 1;
+        }
+    }
+
+    InlineFrameSet frameSet{};
 
     auto turnsTaken = 0;
     while (!frameSet.Ended()) {
-        auto pinsDown = rng() % 11;
-        PinSet pins;
-        for (auto i = 0; i < pinsDown; ++i) {
-            pins.KnockDownPin(static_cast<Pin>(i));
-        }
+        uint_fast64_t pinsDown = 0;
+        auto pins = Simulation::RandomBall(rng, pinsDown);
         std::cout << "Bowled: " << pinsDown << " on turn " << turnsTaken + 1 << "\n";
         frameSet.Bowled(pins);
         ++turnsTaken;
@@ -30,4 +84,4 @@ int main() {
     std::cout << "Turns Taken: " << turnsTaken << "\n";
 
     return 0;
-}
\ No newline at end of file
+}
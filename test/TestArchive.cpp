@@ -0,0 +1,67 @@
+#include "catch.hpp"
+
+#include "Archive.h"
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+SCENARIO("Records written to an archive are read back in place") {
+    GIVEN("An archive written with three records") {
+        const auto path = std::filesystem::temp_directory_path() / "TestArchive.bwl";
+        std::vector<ArchiveRecord> records(3);
+        for (auto i = 0; i < 3; ++i) {
+            records[i].gameId = 100 + i;
+            records[i].bowlerId = 7;
+            records[i].storedScore = 300;
+            records[i].ballCount = 12;
+        }
+        {
+            ArchiveWriter writer{path.string()};
+            writer.Write(records);
+        }
+        WHEN("We map it") {
+            const ArchiveReader reader{path.string()};
+            THEN("The header count and every record should match") {
+                REQUIRE(reader.Records().size() == 3);
+                CHECK(reader.Bytes() == sizeof(ArchiveHeader) + 3 * sizeof(ArchiveRecord));
+                CHECK(reader.Records()[2].gameId == 102);
+                CHECK(reader.Records()[1].storedScore == 300);
+            }
+        }
+        std::filesystem::remove(path);
+    }
+}
+
+SCENARIO("A file that is not an archive is rejected") {
+    GIVEN("A text file") {
+        const auto path = std::filesystem::temp_directory_path() / "TestArchiveNotAnArchive.bwl";
+        std::ofstream{path} << "This is not a bowling archive, it is some text";
+        THEN("Opening it should throw") {
+            REQUIRE_THROWS_AS(ArchiveReader{path.string()}, ArchiveException);
+        }
+        std::filesystem::remove(path);
+    }
+    GIVEN("A path that does not exist") {
+        THEN("Opening it should throw") {
+            REQUIRE_THROWS_AS(ArchiveReader{"/nonexistent/archive.bwl"}, ArchiveException);
+        }
+    }
+}
+
+SCENARIO("A failed archive write is reported by Close and not by the destructor") {
+    GIVEN("Writers on a device that is always full") {
+        std::vector<ArchiveRecord> records(1'000);
+        THEN("Close should throw") {
+            ArchiveWriter writer{"/dev/full"};
+            writer.Write(records);
+            REQUIRE_THROWS_AS(writer.Close(), ArchiveException);
+        }
+        THEN("Leaving the scope without Close should not") {
+            REQUIRE_NOTHROW([&] {
+                ArchiveWriter writer{"/dev/full"};
+                writer.Write(records);
+            }());
+        }
+    }
+}
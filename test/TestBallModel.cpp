@@ -0,0 +1,55 @@
+#include "catch.hpp"
+
+#include "BallModel.h"
+#include "GameStateSpace.h"
+
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+SCENARIO("Uniform balls knock down each count up to what is standing") {
+    GIVEN("Simulation's uniform balls") {
+        const BallModel balls;
+        THEN("Every rack's pinfall sums to one and a full rack is eleven even chances") {
+            for (uint_fast8_t standing = 1; standing <= 10; ++standing)
+                CHECK(std::accumulate(balls[standing].begin(), balls[standing].end(), 0.0) == Approx(1));
+            CHECK(balls[10][0] == Approx(1.0 / 11));
+            CHECK(balls[3][0] == Approx(8.0 / 11));
+        }
+        WHEN("We draw 110000 first balls") {
+            const auto cumulative = balls.Cumulative();
+            std::mt19937_64 rng{12};
+            std::array<int, 11> counts{};
+            for (auto i = 0; i < 110'000; ++i)
+                ++counts[BallModel::Draw(cumulative[10], rng)];
+            THEN("Each count comes up about 10000 times") {
+                for (auto i : counts)
+                    CHECK(std::abs(i - 10'000) < 500);
+            }
+        }
+    }
+}
+
+SCENARIO("Remaining points are worked out backwards over a state space") {
+    GIVEN("The default rules") {
+        const GameStateSpace space;
+        WHEN("Every ball is uniform") {
+            const auto remaining = BallModel{}.Remaining(space);
+            THEN("Each state's distribution sums to one and the end has nothing to come") {
+                CHECK(std::accumulate(remaining[space.Start()].begin(), remaining[space.Start()].end(), 0.0) ==
+                      Approx(1));
+                CHECK(remaining[space.End()][0] == 1);
+            }
+        }
+        WHEN("Every ball is a strike") {
+            BallModel::Table strikes{};
+            for (uint_fast8_t standing = 1; standing <= 10; ++standing)
+                strikes[standing][standing] = 1;
+            const auto remaining = BallModel{strikes}.Remaining(space);
+            THEN("The game is 300") {
+                CHECK(remaining[space.Start()][300] == Approx(1));
+            }
+        }
+    }
+}
@@ -160,3 +160,44 @@ SCENARIO("A FinalFrame after one turn does not consider the turn ended") {
         }
     }
 }
+
+SCENARIO("A strike followed by a partial rack on the FinalFrame earns a bonus ball on the remaining pins") {
+    GIVEN("A FinalFrame instance with a mock PinSet") {
+        auto mockPinsPtr = std::make_unique<MockPinSet>();
+        auto& mockPins = *mockPinsPtr;
+        REQUIRE_CALL(mockPins, OperatorAndEquals(ANY(const IPinSet&))).TIMES(AT_LEAST(1));
+        FinalFrame fFrameMutable{std::move(mockPinsPtr)};
+        WHEN("We bowl a strike and then knock down 5 of the new rack") {
+            ALLOW_CALL(mockPins, PinsDown()).RETURN(10);
+            fFrameMutable.Bowled(MockPinSet{});
+            REQUIRE_CALL(mockPins, Reset());
+            ALLOW_CALL(mockPins, PinsDown()).RETURN(5);
+            fFrameMutable.Bowled(MockPinSet{});
+            THEN("We should be allowed a third ball without the pins being reset") {
+                REQUIRE_FALSE(fFrameMutable.TurnEnded());
+                FORBID_CALL(mockPins, Reset());
+                ALLOW_CALL(mockPins, PinsDown()).RETURN(5 + 3);
+                fFrameMutable.Bowled(MockPinSet{});
+                const auto& fFrame = fFrameMutable;
+                AND_THEN("We should have a StrikeWithBonus of 5 and 3") {
+                    REQUIRE(fFrame.TurnEnded());
+                    const auto score = std::get<IFrame::StrikeWithBonus>(fFrame.Score());
+                    REQUIRE(score.second == 5);
+                    REQUIRE(score.bonus == 3);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("A FinalFrame that has not been bowled on yet scores nothing") {
+    GIVEN("A FinalFrame instance") {
+        const FinalFrame fFrame{std::make_unique<MockPinSet>()};
+        WHEN("We get the score") {
+            const auto score = fFrame.Score();
+            THEN("It should be an empty Open frame") {
+                REQUIRE(std::get<IFrame::Open>(score).total == 0);
+            }
+        }
+    }
+}
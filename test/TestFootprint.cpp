@@ -0,0 +1,63 @@
+#include "catch.hpp"
+
+#include "AllocationTracker.h"
+#include "FinalFrame.h"
+#include "Footprint.h"
+#include "Frame.h"
+#include "FrameSet.h"
+#include "GameArena.h"
+#include "PinSet.h"
+
+#include <string>
+
+// Today's sizes. Raise a budget only on purpose: every byte here is paid per game.
+SCENARIO("The engine types stay within their size budgets") {
+    GIVEN("The footprint of every engine type") {
+        const auto types = Footprint::Types();
+        THEN("The per-game types have not grown") {
+            CHECK(sizeof(PinSet) <= 16);
+            CHECK(sizeof(Frame) <= 24);
+            CHECK(sizeof(FinalFrame) <= 24);
+            CHECK(sizeof(FrameSet) <= 176);
+            CHECK(sizeof(InlineFrameSet) <= 336);
+            CHECK(GameArena::BytesPerGame() <= 800);
+        }
+        THEN("The report lists them") {
+            REQUIRE(types.size() > 5);
+            CHECK(std::string{types[0].name} == "PinSet");
+            CHECK(types[0].size == sizeof(PinSet));
+            CHECK(types[0].alignment == alignof(PinSet));
+        }
+    }
+}
+
+SCENARIO("What a game allocates is counted per subsystem") {
+    REQUIRE(AllocationTracker::Installed());
+    GIVEN("100 games") {
+        constexpr uint_fast64_t games = 100;
+        WHEN("They are played on FrameSets from the heap") {
+            const auto stats = Footprint::Games(SimulationEngine::HEAP, games);
+            THEN("Each game allocates ten frames and ten pin sets and frees them") {
+                CHECK(stats.Allocations(Subsystem::FRAMES) == 10 * games);
+                CHECK(stats.Allocations(Subsystem::PIN_SETS) == 10 * games);
+                CHECK(stats.Allocations() == 20 * games);
+                CHECK(stats.Bytes() == GameArena::BytesPerGame() * games);
+                CHECK(stats.frees == stats.Allocations());
+            }
+        }
+        WHEN("They are played on a GameArena") {
+            const auto stats = Footprint::Games(SimulationEngine::ARENA, games);
+            THEN("Only the arena's one buffer is allocated") {
+                CHECK(stats.Allocations() == 1);
+                CHECK(stats.Allocations(Subsystem::ARENA) == 1);
+                CHECK(stats.Bytes(Subsystem::ARENA) == GameArena::BytesPerGame());
+            }
+        }
+        WHEN("They are played on frames held by value") {
+            const auto stats = Footprint::Games(SimulationEngine::INLINE, games);
+            THEN("Nothing is allocated") {
+                CHECK(stats.Allocations() == 0);
+            }
+        }
+    }
+}
@@ -1,11 +1,15 @@
 #include "catch.hpp"
 
+#include "generator/KnockedDown.h"
+
 #include "FrameSet.h"
+#include "PinSet.h"
 
 #include "mock/MockPinSet.h"
 #include "mock/MockFrame.h"
 
 #include <array>
+#include <random>
 #include <utility>
 #include <vector>
 
@@ -621,3 +625,175 @@ SCENARIO("Getting a strike on the first 2 frames and a Spare (6 + 4) next gives
         }
     }
 }
+
+SCENARIO("Three strikes in a row followed by nothing gives a score of 60") {
+    GIVEN("A FrameSet with 10 mock frames") {
+        auto mockFrames = GenerateMockFrames();
+        FrameSet frameSetMutable{std::move(mockFrames.first)};
+        auto& frames = mockFrames.second;
+        WHEN("We bowl three strikes") {
+            std::vector<std::unique_ptr<trompeloeil::expectation>> expects;
+            for (auto i = 0; i < 3; ++i) {
+                REQUIRE_CALL(frames[i].get(), Bowled(ANY(const IPinSet&))).TIMES(1);
+                REQUIRE_CALL(frames[i].get(), TurnEnded()).RETURN(true);
+                expects.emplace_back(NAMED_ALLOW_CALL(frames[i].get(), Score()).RETURN(IFrame::Strike{}));
+                frameSetMutable.Bowled(MockPinSet{});
+            }
+            AND_WHEN("We bowl nothing for the rest") {
+                for (auto i = 3; i < 10; i++) {
+                    trompeloeil::sequence s;
+                    REQUIRE_CALL(frames[i].get(), Bowled(ANY(const IPinSet&))).TIMES(2);
+                    REQUIRE_CALL(frames[i].get(), TurnEnded()).RETURN(false).IN_SEQUENCE(s);
+                    REQUIRE_CALL(frames[i].get(), TurnEnded()).RETURN(true).IN_SEQUENCE(s);
+                    expects.emplace_back(NAMED_ALLOW_CALL(frames[i].get(), Score()).RETURN(IFrame::Open{0}));
+                    frameSetMutable.Bowled(MockPinSet{});
+                    frameSetMutable.Bowled(MockPinSet{});
+                }
+                const auto& frameSet = frameSetMutable;
+                THEN("We should have a score of 60 and the game has ended") {
+                    CHECK(frameSet.Ended());
+                    CHECK(frameSet.Score() == 60);
+                    AND_THEN("Bowling again should throw") {
+                        REQUIRE_THROWS_AS(frameSetMutable.Bowled(MockPinSet{}), FrameEndedException);
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Scoring a strike on the 9th frame and a strike + 5 + 3 on the 10th gives a score of 43") {
+    GIVEN("A FrameSet with 10 mock frames") {
+        auto mockFrames = GenerateMockFrames();
+        FrameSet frameSetMutable{std::move(mockFrames.first)};
+        auto& frames = mockFrames.second;
+        WHEN("We bowl nothing on the first 8 frames") {
+            std::vector<std::unique_ptr<trompeloeil::expectation>> expects;
+            for (auto i = 0; i < 8; ++i) {
+                trompeloeil::sequence s;
+                REQUIRE_CALL(frames[i].get(), Bowled(ANY(const IPinSet&))).TIMES(2);
+                REQUIRE_CALL(frames[i].get(), TurnEnded()).RETURN(false).IN_SEQUENCE(s);
+                REQUIRE_CALL(frames[i].get(), TurnEnded()).RETURN(true).IN_SEQUENCE(s);
+                expects.emplace_back(NAMED_ALLOW_CALL(frames[i].get(), Score()).RETURN(IFrame::Open{0}));
+                frameSetMutable.Bowled(MockPinSet{});
+                frameSetMutable.Bowled(MockPinSet{});
+            }
+            AND_WHEN("We bowl a strike on the 9th and a strike, 5 and 3 on the 10th") {
+                REQUIRE_CALL(frames[8].get(), Bowled(ANY(const IPinSet&))).TIMES(1);
+                REQUIRE_CALL(frames[8].get(), TurnEnded()).RETURN(true);
+                REQUIRE_CALL(frames[8].get(), Score()).RETURN(IFrame::Strike{});
+                frameSetMutable.Bowled(MockPinSet{});
+                REQUIRE_CALL(frames[9].get(), Bowled(ANY(const IPinSet&))).TIMES(3);
+                trompeloeil::sequence s;
+                REQUIRE_CALL(frames[9].get(), TurnEnded()).RETURN(false).TIMES(2).IN_SEQUENCE(s);
+                REQUIRE_CALL(frames[9].get(), TurnEnded()).RETURN(true).IN_SEQUENCE(s);
+                REQUIRE_CALL(frames[9].get(), Score()).RETURN(IFrame::StrikeWithBonus{5, 3});
+                frameSetMutable.Bowled(MockPinSet{});
+                frameSetMutable.Bowled(MockPinSet{});
+                frameSetMutable.Bowled(MockPinSet{});
+                const auto& frameSet = frameSetMutable;
+                THEN("We should have a score of 43 and the game has ended") {
+                    CHECK(frameSet.Ended());
+                    CHECK(frameSet.Score() == 43);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Frame scores are cumulative and only bowled frames advance the running total") {
+    GIVEN("A FrameSet with real frames") {
+        FrameSet frameSet{};
+        WHEN("We bowl X 7/ 9- X -8 8/ -6 X X X81") {
+            // Each ball is the cumulative count of pins down on the current rack.
+            const std::vector<uint_fast8_t> balls{10, 7, 10, 9, 9, 10, 0, 8, 8, 10, 0, 6, 10, 10, 10, 8, 9};
+            for (auto i : balls)
+                frameSet.Bowled(KnockedDown(i));
+            THEN("Each frame carries the running total including its bonuses") {
+                const std::array<uint_fast16_t, 10> expected{20, 39, 48, 66, 74, 84, 90, 120, 148, 167};
+                CHECK(frameSet.FrameScores() == expected);
+                CHECK(frameSet.Score() == 167);
+            }
+        }
+        WHEN("We bowl a strike followed by a single 4") {
+            frameSet.Bowled(KnockedDown(10));
+            frameSet.Bowled(KnockedDown(4));
+            THEN("The strike frame counts the pending ball and later frames repeat the total") {
+                const auto& scores = frameSet.FrameScores();
+                CHECK(scores[0] == 14);
+                CHECK(scores[1] == 18);
+                CHECK(scores[9] == 18);
+            }
+        }
+    }
+}
+
+SCENARIO("The frame score cache always agrees with Score on random games") {
+    GIVEN("A random number generator") {
+        std::mt19937_64 rng{31};
+        WHEN("We bowl 200 random games and read the scoreboard after every ball") {
+            auto mismatches = 0;
+            for (auto game = 0; game < 200; ++game) {
+                FrameSet frameSet{};
+                uint_fast16_t previous = 0;
+                while (!frameSet.Ended()) {
+                    PinSet ball;
+                    for (auto i = 0; i < 10; ++i)
+                        if (rng() % 3)
+                            ball.KnockDownPin(static_cast<Pin>(i));
+                    frameSet.Bowled(ball);
+                    const auto& scores = frameSet.FrameScores();
+                    if (scores[9] != frameSet.Score() || scores[0] > scores[9] || scores[9] < previous)
+                        ++mismatches;
+                    previous = scores[9];
+                }
+            }
+            THEN("The final frame always holds the game score") {
+                REQUIRE(mismatches == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("Reading frame scores after a ball only rescored the frames it can affect") {
+    GIVEN("A FrameSet with 10 mock frames") {
+        auto mockFrames = GenerateMockFrames();
+        FrameSet frameSetMutable{std::move(mockFrames.first)};
+        auto& frames = mockFrames.second;
+        WHEN("We bowl eight open frames of 4 and read the scoreboard") {
+            std::vector<std::unique_ptr<trompeloeil::expectation>> expects;
+            for (auto i = 0; i < 8; ++i) {
+                trompeloeil::sequence s;
+                REQUIRE_CALL(frames[i].get(), Bowled(ANY(const IPinSet&))).TIMES(2);
+                REQUIRE_CALL(frames[i].get(), TurnEnded()).RETURN(false).IN_SEQUENCE(s);
+                REQUIRE_CALL(frames[i].get(), TurnEnded()).RETURN(true).IN_SEQUENCE(s);
+                frameSetMutable.Bowled(MockPinSet{});
+                frameSetMutable.Bowled(MockPinSet{});
+            }
+            {
+                std::vector<std::unique_ptr<trompeloeil::expectation>> scoring;
+                for (auto i = 0; i < 9; ++i)
+                    scoring.emplace_back(NAMED_REQUIRE_CALL(frames[i].get(), Score()).RETURN(IFrame::Open{4, 2, 2}));
+                REQUIRE(frameSetMutable.FrameScores()[7] == 32);
+            }
+            AND_WHEN("We bowl a strike on the 9th frame") {
+                REQUIRE_CALL(frames[8].get(), Bowled(ANY(const IPinSet&)));
+                REQUIRE_CALL(frames[8].get(), TurnEnded()).RETURN(true);
+                frameSetMutable.Bowled(MockPinSet{});
+                THEN("Only the 7th frame onwards is asked for its score again") {
+                    REQUIRE_CALL(frames[6].get(), Score()).RETURN(IFrame::Open{4, 2, 2});
+                    REQUIRE_CALL(frames[7].get(), Score()).RETURN(IFrame::Open{4, 2, 2});
+                    REQUIRE_CALL(frames[8].get(), Score()).RETURN(IFrame::Strike{});
+                    REQUIRE_CALL(frames[9].get(), Score()).RETURN(IFrame::Open{});
+                    const auto& scores = frameSetMutable.FrameScores();
+                    CHECK(scores[7] == 32);
+                    CHECK(scores[8] == 42);
+                    CHECK(scores[9] == 42);
+                    AND_THEN("Reading it again without bowling asks no frame at all") {
+                        CHECK(frameSetMutable.FrameScores()[9] == 42);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#include "catch.hpp"
+
+#include "FrameSet.h"
+#include "GameArena.h"
+#include "PinSet.h"
+
+#include <memory_resource>
+#include <vector>
+
+class CountingUpstream : public std::pmr::memory_resource {
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    int allocations = 0;
+    int deallocations = 0;
+};
+
+static void PlayPerfectGame(FrameSet& frameSet) {
+    PinSet strike;
+    for (auto i = 0; i < 10; ++i)
+        strike.KnockDownPin(static_cast<Pin>(i));
+    while (!frameSet.Ended())
+        frameSet.Bowled(strike);
+}
+
+SCENARIO("A FrameSet built on a memory resource takes all of its frames and pins from it") {
+    GIVEN("A counting memory resource") {
+        CountingUpstream resource;
+        WHEN("We build a FrameSet on it and play a game") {
+            {
+                FrameSet frameSet{&resource};
+                PlayPerfectGame(frameSet);
+                THEN("Ten frames and ten pin sets should have been allocated and the game scored normally") {
+                    REQUIRE(resource.allocations == 20);
+                    REQUIRE(frameSet.Score() == 300);
+                }
+            }
+            THEN("Destroying the FrameSet should return everything to the resource") {
+                REQUIRE(resource.deallocations == 20);
+            }
+        }
+    }
+}
+
+SCENARIO("A GameArena serves repeated batches without going back to its upstream resource") {
+    GIVEN("An arena sized for a batch of games") {
+        CountingUpstream upstream;
+        GameArena arena{50, &upstream};
+        std::vector<FrameSet> games;
+        games.reserve(50);
+        WHEN("We play several full batches, resetting the arena in between") {
+            for (auto batch = 0; batch < 3; ++batch) {
+                for (auto i = 0; i < 50; ++i)
+                    games.emplace_back(arena.Resource());
+                for (auto& i : games)
+                    PlayPerfectGame(i);
+                REQUIRE(games.back().Score() == 300);
+                games.clear();
+                arena.Reset();
+            }
+            THEN("The upstream resource should never have been used") {
+                REQUIRE(upstream.allocations == 0);
+            }
+        }
+    }
+}
@@ -0,0 +1,74 @@
+#include "catch.hpp"
+
+#include "FrameSet.h"
+#include "GameBatch.h"
+#include "PinSet.h"
+
+#include <random>
+#include <vector>
+
+SCENARIO("A GameBatch of perfect games scores 300 each") {
+    GIVEN("A batch of 64 games") {
+        GameBatch batch{64};
+        WHEN("Every game bowls twelve strikes") {
+            const std::vector<PinMask> strikes(64, 0);
+            for (auto i = 0; i < 12; ++i)
+                batch.BowlAll(strikes);
+            std::vector<uint16_t> scores(64);
+            batch.ScoreAll(scores);
+            THEN("Every game should have ended with 300") {
+                REQUIRE(batch.EndedCount() == 64);
+                for (auto i : scores)
+                    REQUIRE(i == 300);
+            }
+        }
+    }
+}
+
+SCENARIO("A GameBatch matches FrameSet ball for ball on random games") {
+    GIVEN("A batch and a FrameSet per game") {
+        constexpr std::size_t games = 500;
+        GameBatch batch{games};
+        std::vector<FrameSet> frameSets(games);
+        std::mt19937_64 rng{1234};
+        WHEN("We bowl random pin masks until every game has ended") {
+            std::vector<PinMask> balls(games);
+            std::vector<uint16_t> scores(games);
+            auto mismatches = 0;
+            for (auto turn = 0; turn < 21; ++turn) {
+                for (auto& i : balls)
+                    i = rng() % 4 ? static_cast<PinMask>(rng() & 0x3FF) : 0;
+                batch.BowlAll(balls);
+                batch.ScoreAll(scores);
+                for (std::size_t i = 0; i < games; ++i) {
+                    if (!frameSets[i].Ended())
+                        frameSets[i].Bowled(PinSet{balls[i]});
+                    if (scores[i] != frameSets[i].Score() || batch.Ended(i) != frameSets[i].Ended())
+                        ++mismatches;
+                }
+            }
+            THEN("Every score and end-of-game flag should have matched along the way") {
+                REQUIRE(mismatches == 0);
+                REQUIRE(batch.EndedCount() == games);
+            }
+        }
+    }
+}
+
+SCENARIO("A reset GameBatch starts every game again") {
+    GIVEN("A batch where a strike has been bowled") {
+        GameBatch batch{4};
+        const std::vector<PinMask> strikes(4, 0);
+        batch.BowlAll(strikes);
+        WHEN("We reset it") {
+            batch.Reset();
+            std::vector<uint16_t> scores(4, 1);
+            batch.ScoreAll(scores);
+            THEN("The scores should be back to zero") {
+                for (auto i : scores)
+                    REQUIRE(i == 0);
+                REQUIRE(batch.EndedCount() == 0);
+            }
+        }
+    }
+}
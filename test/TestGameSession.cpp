@@ -0,0 +1,92 @@
+#include "catch.hpp"
+
+#include "generator/KnockedDown.h"
+
+#include "FrameSet.h"
+#include "GameSession.h"
+#include "PinSet.h"
+
+#include <array>
+#include <memory_resource>
+
+class TrackingResource : public std::pmr::memory_resource {
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        ++deallocations;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    int allocations = 0;
+    int deallocations = 0;
+};
+
+SCENARIO("A GameSession yields a score update for every ball of a perfect game") {
+    GIVEN("A session playing a fresh InlineFrameSet") {
+        InlineFrameSet frameSet{};
+        auto session = GameSession::Play(frameSet);
+        WHEN("We bowl twelve strikes") {
+            const auto strike = KnockedDown(10);
+            for (auto i = 0; i < 11; ++i) {
+                const auto& update = session.Bowled(strike);
+                REQUIRE_FALSE(update.ended);
+                REQUIRE(update.turn == i + 1);
+            }
+            const auto last = session.Bowled(strike);
+            THEN("The last update should report 300 in the tenth frame and the end of the game") {
+                REQUIRE(last.score == 300);
+                REQUIRE(last.frame == 9);
+                REQUIRE(last.ended);
+                REQUIRE(session.Ended());
+                AND_THEN("Bowling again should throw") {
+                    REQUIRE_THROWS_AS(session.Bowled(strike), FrameEndedException);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("A GameSession reports the running score as the game progresses") {
+    GIVEN("A session playing a fresh InlineFrameSet") {
+        InlineFrameSet frameSet{};
+        auto session = GameSession::Play(frameSet);
+        WHEN("We bowl a spare of 7 and 3, then 4") {
+            const auto first = session.Bowled(KnockedDown(7));
+            const auto second = session.Bowled(KnockedDown(10));
+            const auto third = session.Bowled(KnockedDown(4));
+            THEN("Each update should reflect the score so far") {
+                REQUIRE(first.score == 7);
+                REQUIRE(first.frame == 0);
+                REQUIRE(second.score == 10);
+                REQUIRE(third.score == 18);
+                REQUIRE(third.frame == 1);
+            }
+        }
+    }
+}
+
+SCENARIO("A GameSession allocates its coroutine frame from the given memory resource") {
+    GIVEN("A tracking memory resource") {
+        TrackingResource resource;
+        InlineFrameSet frameSet{};
+        WHEN("We start and play part of a session on it") {
+            {
+                auto session = GameSession::Play(std::allocator_arg, resource, frameSet);
+                session.Bowled(KnockedDown(3));
+                session.Bowled(KnockedDown(5));
+                THEN("Only the coroutine frame should have been allocated from it") {
+                    REQUIRE(resource.allocations == 1);
+                }
+            }
+            THEN("The frame should be returned to it when the session is destroyed") {
+                REQUIRE(resource.deallocations == 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,121 @@
+#include "catch.hpp"
+
+#include "generator/KnockedDown.h"
+
+#include "FrameSet.h"
+#include "GameStateSpace.h"
+#include "GameStateTable.h"
+#include "PinSet.h"
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <vector>
+
+SCENARIO("The generated state table is in sync with the frame rules") {
+    GIVEN("A freshly enumerated state space") {
+        const GameStateSpace space;
+        WHEN("We write it out as a header") {
+            std::ostringstream header;
+            space.WriteHeader(header);
+            THEN("It should match the checked in table, entry for entry") {
+                REQUIRE(space.Size() == GameStateTable::stateCount);
+                REQUIRE(space.End() == GameStateTable::end);
+                auto mismatches = 0;
+                for (uint16_t id = 0; id < space.Size(); ++id) {
+                    if (space.At(id).frame != GameStateTable::frame[id] ||
+                        space.At(id).standing != GameStateTable::standing[id])
+                        ++mismatches;
+                    for (uint_fast8_t pins = 0; pins <= 10; ++pins)
+                        if (space.Next(id, pins) != GameStateTable::next[id][pins] ||
+                            space.Points(id, pins) != GameStateTable::points[id][pins])
+                            ++mismatches;
+                }
+                CHECK(mismatches == 0);
+                CHECK(header.str().find("stateCount = " + std::to_string(space.Size())) != std::string::npos);
+            }
+        }
+    }
+}
+
+SCENARIO("Walking the state table scores games like FrameSet") {
+    GIVEN("The state space and a random number generator") {
+        const GameStateSpace space;
+        std::mt19937_64 rng{32};
+        WHEN("We bowl 2000 random count-only games through both") {
+            auto mismatches = 0;
+            for (auto game = 0; game < 2000; ++game) {
+                FrameSet frameSet{};
+                auto state = space.Start();
+                uint_fast16_t score = 0;
+                while (!frameSet.Ended()) {
+                    const auto pins = static_cast<uint_fast8_t>(rng() % (space.At(state).standing + 1));
+                    frameSet.Bowled(KnockedDown(10 - space.At(state).standing + pins));
+                    score += space.Points(state, pins);
+                    state = space.Next(state, pins);
+                    if (score != frameSet.Score())
+                        ++mismatches;
+                }
+                if (state != space.End())
+                    ++mismatches;
+            }
+            THEN("Every running score and every game end should agree") {
+                REQUIRE(mismatches == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("Dynamic programming over the state table finds the perfect game") {
+    GIVEN("The generated state table") {
+        WHEN("We take the best score from each state to the end, last state first") {
+            std::vector<int> best(GameStateTable::stateCount, 0);
+            auto backwards = 0;
+            for (int id = GameStateTable::stateCount - 2; id >= 0; --id) {
+                best[id] = -1;
+                for (auto pins = 0; pins <= 10; ++pins) {
+                    const auto next = GameStateTable::next[id][pins];
+                    if (next == GameStateTable::invalid)
+                        continue;
+                    if (next <= id)
+                        ++backwards;
+                    best[id] = std::max(best[id], GameStateTable::points[id][pins] + best[next]);
+                }
+            }
+            THEN("The best game from the start should be 300") {
+                CHECK(backwards == 0);
+                REQUIRE(best[GameStateTable::start] == 300);
+            }
+        }
+    }
+}
+
+SCENARIO("Without bonus balls in the tenth frame the best game is 270") {
+    GIVEN("A state space where the tenth frame is an ordinary frame") {
+        const GameStateSpace space{{false}};
+        WHEN("We strike with every ball") {
+            auto state = space.Start();
+            uint_fast16_t score = 0;
+            auto balls = 0;
+            while (state != space.End()) {
+                score += space.Points(state, 10);
+                state = space.Next(state, 10);
+                ++balls;
+            }
+            THEN("The game ends after ten balls, and the last two frames get no full bonus") {
+                CHECK(balls == 10);
+                CHECK(score == 270);
+                CHECK(space.Size() < GameStateTable::stateCount);
+            }
+        }
+        WHEN("We spare in the tenth frame") {
+            auto state = space.Start();
+            while (space.At(state).frame < 9)
+                state = space.Next(state, 0);
+            state = space.Next(space.Next(state, 4), 6);
+            THEN("The game is over") {
+                CHECK(state == space.End());
+            }
+        }
+    }
+}
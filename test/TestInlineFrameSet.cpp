@@ -0,0 +1,107 @@
+#include "catch.hpp"
+
+#include "generator/RandomGame.h"
+
+#include "FrameSet.h"
+#include "PinSet.h"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+// Each ball is the mask of pins left standing on the rack after it.
+template <std::size_t N>
+constexpr uint_fast16_t PlayInline(const std::array<uint16_t, N>& balls) {
+    InlineFrameSet frameSet{};
+    for (auto i : balls)
+        frameSet.Bowled(PinSet{i});
+    return frameSet.Score();
+}
+
+constexpr std::array<uint16_t, 12> perfectGame{};
+
+constexpr std::array<uint16_t, 21> ninesAndSpares{
+        1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1
+};
+
+static_assert(PlayInline(perfectGame) == 300);
+static_assert(PlayInline(ninesAndSpares) == 190);
+
+// Score after bowling n strikes and then gutter balls to the end, folded at compile time.
+constexpr std::array<uint_fast16_t, 13> BuildStrikeRunTable() {
+    std::array<uint_fast16_t, 13> table{};
+    for (std::size_t n = 0; n < table.size(); ++n) {
+        InlineFrameSet frameSet{};
+        for (std::size_t i = 0; i < n; ++i)
+            frameSet.Bowled(PinSet{0});
+        while (!frameSet.Ended())
+            frameSet.Bowled(PinSet{0b11'11'11'11'11});
+        table[n] = frameSet.Score();
+    }
+    return table;
+}
+
+constexpr auto strikeRunTable = BuildStrikeRunTable();
+
+static_assert(strikeRunTable[0] == 0);
+static_assert(strikeRunTable[1] == 10);
+static_assert(strikeRunTable[3] == 60);
+static_assert(strikeRunTable[12] == 300);
+
+// Bowls each game into a FrameSet and a BasicFrameSet<Frames> side by side; the
+// property fails on the first ball where scores, frame scores or the current frame
+// differ, or if the game does not end on its own score.
+template <typename Frames>
+static std::optional<RandomGame> FindDivergence(const Catch::Generators::Generator<RandomGame>& games) {
+    return FindCounterexample(games, [](const RandomGame& game) {
+        FrameSet frameSet{};
+        BasicFrameSet<Frames> other{};
+        for (auto i : game.balls) {
+            frameSet.Bowled(PinSet{i});
+            other.Bowled(PinSet{i});
+            if (frameSet.Score() != other.Score() ||
+                frameSet.FrameScores() != other.FrameScores() ||
+                frameSet.CurrentFrame() != other.CurrentFrame())
+                return false;
+        }
+        return other.Ended() && other.Score() == game.Score();
+    });
+}
+
+template <typename Frames>
+static void RequireEndedAfterPerfectGame() {
+    BasicFrameSet<Frames> frameSet{};
+    for (auto i = 0; i < 12; ++i)
+        frameSet.Bowled(PinSet{0});
+    REQUIRE(frameSet.Ended());
+    REQUIRE(frameSet.Score() == 300);
+    REQUIRE_THROWS_AS(frameSet.Bowled(PinSet{0}), FrameEndedException);
+}
+
+SCENARIO("An InlineFrameSet scores exactly like a FrameSet") {
+    GIVEN("10000 random games") {
+        const auto games = randomGames(10'000, 38);
+        WHEN("We bowl each one into both") {
+            const auto counterexample = FindDivergence<InlineFrames>(games);
+            THEN("Scores, frame scores and the current frame should always agree") {
+                REQUIRE_FALSE(counterexample);
+            }
+        }
+    }
+}
+
+SCENARIO("Every engine refuses balls after the game has ended") {
+    GIVEN("A perfect game") {
+        WHEN("It is played on a FrameSet") {
+            THEN("Another ball should throw") {
+                RequireEndedAfterPerfectGame<HeapFrames>();
+            }
+        }
+        WHEN("It is played on an InlineFrameSet") {
+            THEN("Another ball should throw") {
+                RequireEndedAfterPerfectGame<InlineFrames>();
+            }
+        }
+    }
+}
@@ -0,0 +1,105 @@
+#include "catch.hpp"
+
+#include "LaneSession.h"
+#include "PinSet.h"
+
+#include "mock/MockLaneListener.h"
+
+#include <memory_resource>
+#include <vector>
+
+class RecordingListener : public ILaneListener {
+public:
+    std::vector<BallEvent> balls;
+    std::vector<FrameEvent> frames;
+
+    void BallBowled(const BallEvent& event) override {
+        balls.push_back(event);
+    }
+
+    void FrameEnded(const FrameEvent& event) override {
+        frames.push_back(event);
+    }
+};
+
+SCENARIO("Bowlers take turns a frame at a time and swap lanes every frame") {
+    GIVEN("A session of three bowlers starting on the right lane") {
+        RecordingListener listener;
+        LaneSession session{3, 1, &listener};
+        WHEN("The first bowler strikes, the second leaves a spare and the third throws two gutters") {
+            session.Bowled(PinSet{0});
+            REQUIRE(session.CurrentBowler() == 1);
+            session.Bowled(PinSet{0b11'00'00'00'00});
+            session.Bowled(PinSet{0});
+            REQUIRE(session.CurrentBowler() == 2);
+            session.Bowled(PinSet{0b11'11'11'11'11});
+            session.Bowled(PinSet{0b11'11'11'11'11});
+            THEN("The first bowler is up again in the second frame, on the left lane") {
+                CHECK(session.CurrentBowler() == 0);
+                CHECK(session.CurrentFrame() == 1);
+                CHECK(session.CurrentLane() == 0);
+                REQUIRE(listener.balls.size() == 5);
+                CHECK(listener.balls[2].bowler == 1);
+                CHECK(listener.balls[2].ball == 1);
+                CHECK(listener.balls[2].lane == 1);
+                REQUIRE(listener.frames.size() == 3);
+                CHECK(listener.frames[0].score == 10);
+                CHECK(listener.frames[1].bowler == 1);
+                CHECK(listener.frames[2].score == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("A lane session ends when the last bowler finishes the tenth frame") {
+    GIVEN("A session of six bowlers who all bowl perfect games") {
+        MockLaneListener listener;
+        LaneSession session{6, 0, &listener};
+        ALLOW_CALL(listener, BallBowled(ANY(const ILaneListener::BallEvent&)));
+        ALLOW_CALL(listener, FrameEnded(trompeloeil::_)).WITH(!_1.gameEnded);
+        for (std::size_t bowler = 0; bowler < 6; ++bowler) {
+            REQUIRE_CALL(listener, FrameEnded(trompeloeil::_))
+                .WITH(_1.bowler == bowler && _1.frame == 9 && _1.score == 300 && _1.gameEnded);
+            while (session.CurrentFrame() < 9 || session.CurrentBowler() != bowler)
+                session.Bowled(PinSet{0});
+            for (auto i = 0; i < 3; ++i)
+                session.Bowled(PinSet{0});
+        }
+        THEN("Every game is 300 and another ball throws") {
+            REQUIRE(session.Ended());
+            for (std::size_t i = 0; i < session.Bowlers(); ++i)
+                CHECK(session.Game(i).Score() == 300);
+            REQUIRE_THROWS_AS(session.Bowled(PinSet{0}), FrameEndedException);
+        }
+    }
+    GIVEN("A session with no bowlers or seven") {
+        THEN("It cannot be made") {
+            REQUIRE_THROWS_AS(LaneSession{0}, std::invalid_argument);
+            REQUIRE_THROWS_AS(LaneSession{7}, std::invalid_argument);
+        }
+    }
+}
+
+SCENARIO("Lane sessions take their games from one block of the memory resource") {
+    GIVEN("A pool and 1000 sessions of four bowlers") {
+        std::pmr::unsynchronized_pool_resource pool;
+        std::vector<LaneSession> sessions;
+        sessions.reserve(1000);
+        for (auto i = 0; i < 1000; ++i)
+            sessions.emplace_back(4, i % 2, nullptr, &pool);
+        WHEN("Every session plays to the end with nine-pin first balls and spares") {
+            for (auto& session : sessions)
+                while (!session.Ended()) {
+                    session.Bowled(PinSet{0b10'00'00'00'00});
+                    session.Bowled(PinSet{0});
+                    if (session.CurrentFrame() == 9 && session.Game(session.CurrentBowler()).FrameBalls(9).count == 2)
+                        session.Bowled(PinSet{0b10'00'00'00'00});
+                }
+            THEN("Every game scores 190") {
+                for (const auto& session : sessions)
+                    for (std::size_t i = 0; i < session.Bowlers(); ++i)
+                        REQUIRE(session.Game(i).Score() == 190);
+            }
+        }
+    }
+}
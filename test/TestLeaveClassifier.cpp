@@ -0,0 +1,114 @@
+#include "catch.hpp"
+
+#include "LeaveClassifier.h"
+#include "PinSet.h"
+
+#include <initializer_list>
+#include <vector>
+
+static constexpr uint_fast16_t Standing(std::initializer_list<Pin> pins) {
+    uint_fast16_t mask = 0;
+    for (auto p : pins)
+        mask |= uint_fast16_t{1} << static_cast<uint8_t>(p);
+    return mask;
+}
+
+static_assert(LeaveClassifier::Classify(0).type == LeaveType::NONE);
+static_assert(LeaveClassifier::Classify(Standing({Pin::SEVEN, Pin::TEN})).name == NamedLeave::SEVEN_TEN);
+static_assert(LeaveClassifier::Classify(LeaveClassifier::allPins).type == LeaveType::MULTI_PIN);
+
+SCENARIO("The classic splits are recognised and named") {
+    GIVEN("The standing masks of the 7-10, 4-6 and Big Four") {
+        const auto sevenTen = LeaveClassifier::Classify(Standing({Pin::SEVEN, Pin::TEN}));
+        const auto fourSix = LeaveClassifier::Classify(Standing({Pin::FOUR, Pin::SIX}));
+        const auto bigFour = LeaveClassifier::Classify(Standing({Pin::FOUR, Pin::SIX, Pin::SEVEN, Pin::TEN}));
+        THEN("They should all be classified as named splits") {
+            REQUIRE(sevenTen.type == LeaveType::SPLIT);
+            REQUIRE(sevenTen.name == NamedLeave::SEVEN_TEN);
+            REQUIRE(fourSix.type == LeaveType::SPLIT);
+            REQUIRE(fourSix.name == NamedLeave::FOUR_SIX);
+            REQUIRE(bigFour.type == LeaveType::SPLIT);
+            REQUIRE(bigFour.name == NamedLeave::BIG_FOUR);
+            REQUIRE(bigFour.pinsUp == 4);
+        }
+    }
+}
+
+SCENARIO("The 2-7 and 3-10 are baby splits") {
+    GIVEN("The standing masks of the 2-7 and 3-10") {
+        const auto twoSeven = LeaveClassifier::Classify(Standing({Pin::TWO, Pin::SEVEN}));
+        const auto threeTen = LeaveClassifier::Classify(Standing({Pin::THREE, Pin::TEN}));
+        THEN("Both should be baby splits, which still count as splits") {
+            REQUIRE(twoSeven.type == LeaveType::BABY_SPLIT);
+            REQUIRE(threeTen.type == LeaveType::BABY_SPLIT);
+            REQUIRE(twoSeven.IsSplit());
+        }
+    }
+}
+
+SCENARIO("A split with the head pin standing is a washout") {
+    GIVEN("The 1-2-10 and 1-2-4-10 leaves") {
+        const auto oneTwoTen = LeaveClassifier::Classify(Standing({Pin::ONE, Pin::TWO, Pin::TEN}));
+        const auto oneTwoFourTen = LeaveClassifier::Classify(Standing({Pin::ONE, Pin::TWO, Pin::FOUR, Pin::TEN}));
+        THEN("Both should be washouts and not splits") {
+            REQUIRE(oneTwoTen.type == LeaveType::WASHOUT);
+            REQUIRE(oneTwoFourTen.type == LeaveType::WASHOUT);
+            REQUIRE_FALSE(oneTwoTen.IsSplit());
+        }
+    }
+}
+
+SCENARIO("Touching pins and sleepers are not splits") {
+    GIVEN("The bucket, the 2-8 sleeper and a lone 10 pin") {
+        const auto bucket = LeaveClassifier::Classify(Standing({Pin::TWO, Pin::FOUR, Pin::FIVE, Pin::EIGHT}));
+        const auto sleeper = LeaveClassifier::Classify(Standing({Pin::TWO, Pin::EIGHT}));
+        const auto tenPin = LeaveClassifier::Classify(Standing({Pin::TEN}));
+        THEN("They should be classified as ordinary spares") {
+            REQUIRE(bucket.type == LeaveType::MULTI_PIN);
+            REQUIRE(sleeper.type == LeaveType::MULTI_PIN);
+            REQUIRE(tenPin.type == LeaveType::SINGLE_PIN);
+        }
+    }
+}
+
+SCENARIO("Classifying through the IPinSet interface matches the mask lookup") {
+    GIVEN("A PinSet where everything but the 4 and 6 pins was knocked down") {
+        PinSet pinsMutable;
+        for (auto p : {Pin::ONE, Pin::TWO, Pin::THREE, Pin::FIVE, Pin::SEVEN, Pin::EIGHT, Pin::NINE, Pin::TEN})
+            pinsMutable.KnockDownPin(p);
+        const auto& pins = pinsMutable;
+        WHEN("We classify the PinSet both ways") {
+            const auto viaInterface = LeaveClassifier::Classify(static_cast<const IPinSet&>(pins));
+            const auto viaMask = LeaveClassifier::Classify(pins.Mask());
+            THEN("Both should report the 4-6 split") {
+                REQUIRE(viaInterface.name == NamedLeave::FOUR_SIX);
+                REQUIRE(viaMask.name == NamedLeave::FOUR_SIX);
+            }
+        }
+    }
+}
+
+SCENARIO("A batch of leaves is classified and tallied") {
+    GIVEN("An archive of first-ball leaves") {
+        const std::vector<uint16_t> leaves{
+                0,
+                Standing({Pin::SEVEN, Pin::TEN}),
+                Standing({Pin::TEN}),
+                Standing({Pin::TWO, Pin::SEVEN}),
+                0
+        };
+        WHEN("We classify and count them in bulk") {
+            std::vector<Leave> out(leaves.size());
+            LeaveClassifier::ClassifyAll(leaves.data(), leaves.size(), out.data());
+            const auto counts = LeaveClassifier::CountTypes(leaves.data(), leaves.size());
+            THEN("Each leave should be classified individually and counted by type") {
+                REQUIRE(out[1].name == NamedLeave::SEVEN_TEN);
+                REQUIRE(out[3].type == LeaveType::BABY_SPLIT);
+                REQUIRE(counts[static_cast<uint8_t>(LeaveType::NONE)] == 2);
+                REQUIRE(counts[static_cast<uint8_t>(LeaveType::SINGLE_PIN)] == 1);
+                REQUIRE(counts[static_cast<uint8_t>(LeaveType::SPLIT)] == 1);
+                REQUIRE(counts[static_cast<uint8_t>(LeaveType::BABY_SPLIT)] == 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,179 @@
+#include "catch.hpp"
+
+#include "generator/RandomGame.h"
+
+#include "FrameSet.h"
+#include "Notation.h"
+#include "PinSet.h"
+
+#include <string>
+#include <vector>
+
+static FrameSet Play(const NotationGame& game) {
+    FrameSet frameSet{};
+    for (auto i = 0; i < game.ballCount; ++i)
+        frameSet.Bowled(PinSet{game.balls[i]});
+    return frameSet;
+}
+
+SCENARIO("Notation is parsed into balls that score like the written game") {
+    GIVEN("The game X 7/ 9- X -8 8/ -6 X X X81") {
+        const auto game = Notation::Parse("X 7/ 9- X -8 8/ -6 X X X81");
+        THEN("It should have 17 balls that score 167, frame by frame") {
+            REQUIRE(game.ballCount == 17);
+            const auto frameSet = Play(game);
+            REQUIRE(frameSet.Ended());
+            const std::array<uint_fast16_t, 10> expected{20, 39, 48, 66, 74, 84, 90, 120, 148, 167};
+            CHECK(frameSet.FrameScores() == expected);
+        }
+    }
+    GIVEN("A perfect game, a game of 9/ and one with fouls, zeros and extra whitespace") {
+        THEN("They should score 300, 190 and 90") {
+            CHECK(Play(Notation::Parse("X X X X X X X X X XXX")).Score() == 300);
+            CHECK(Play(Notation::Parse("9/ 9/ 9/ 9/ 9/ 9/ 9/ 9/ 9/ 9/9")).Score() == 190);
+            CHECK(Play(Notation::Parse("  F9\t09 -9 9- 9- 9- 9- 9- 9- 9- \r")).Score() == 90);
+        }
+    }
+    GIVEN("A tenth frame strike followed by a spare") {
+        const auto game = Notation::Parse("-- -- -- -- -- -- -- -- -- X7/");
+        THEN("The bonus balls are on a fresh rack and then the same rack") {
+            REQUIRE(game.ballCount == 21);
+            CHECK(game.balls[18] == 0);
+            CHECK(game.balls[19] == 0b11'10'00'00'00);
+            CHECK(game.balls[20] == 0);
+            CHECK(Play(game).Score() == 20);
+        }
+    }
+}
+
+SCENARIO("Illegal notation is rejected with the line and column") {
+    GIVEN("Games that break the rules") {
+        const auto illegal = GENERATE(as<std::string>(),
+                "X 9/ 8",                                  // too short
+                "X X X X X X X X X X",                     // tenth frame strike without bonus balls
+                "X X X X X X X X X XXXX",                  // too many balls
+                "/5 X X X X X X X X XXX",                  // spare on a first ball
+                "55 X X X X X X X X XXX",                  // ten pins without a spare
+                "5X X X X X X X X X XXX",                  // strike on a second ball
+                "XX X X X X X X X XXX",                    // frames run together
+                "X X X X X X X X X X5X",                   // strike on a rack with pins standing
+                "X X X X X X X X X 45X",                   // bonus ball without a mark
+                "X X X X Y X X X X XXX");                  // not notation
+        THEN("Parsing throws") {
+            REQUIRE_THROWS_AS(Notation::Parse(illegal), NotationException);
+        }
+    }
+    GIVEN("A stream whose third line is illegal") {
+        NotationStream stream;
+        THEN("The error names line 3") {
+            REQUIRE_THROWS_WITH(stream.Feed("X X X X X X X X X XXX\n\nX 9/ 8\n"), Catch::StartsWith("line 3, column 7"));
+        }
+        WHEN("More games follow the illegal line in the same chunk") {
+            CHECK_THROWS_AS(stream.Feed("X X X X X X X X X XXX\n\nX 9/ 8\n9- 9- 9- 9- 9- 9- 9- 9- 9- 9-\nX X X X X "),
+                            NotationException);
+            THEN("The games before it are kept and the stream resumes after it") {
+                CHECK(stream.Games().size() == 1);
+                const auto games = stream.Feed("X X X X XXX\n");
+                REQUIRE(games.size() == 2);
+                CHECK(Play(games[0]).Score() == 90);
+                CHECK(Play(games[1]).Score() == 300);
+                REQUIRE_THROWS_WITH(stream.Feed("Y\n"), Catch::StartsWith("line 6"));
+                CHECK(stream.Finish().empty());
+            }
+        }
+    }
+}
+
+SCENARIO("Character classification matches the notation alphabet") {
+    GIVEN("Every byte value") {
+        std::string text;
+        for (auto c = 0; c < 256; ++c)
+            text += static_cast<char>(c);
+        std::vector<uint8_t> symbols(text.size());
+        WHEN("We classify them") {
+            Notation::Classify(text, symbols);
+            THEN("Only the notation characters are valid") {
+                for (auto c = 0; c < 256; ++c) {
+                    auto expected = Notation::Symbol::INVALID;
+                    if (c >= '0' && c <= '9')
+                        expected = static_cast<Notation::Symbol>(c - '0');
+                    else if (c == '-' || c == 'F')
+                        expected = static_cast<Notation::Symbol>(0);
+                    else if (c == 'X' || c == 'x')
+                        expected = Notation::Symbol::STRIKE;
+                    else if (c == '/')
+                        expected = Notation::Symbol::SPARE;
+                    else if (c == ' ' || c == '\t' || c == '\r')
+                        expected = Notation::Symbol::SEPARATOR;
+                    else if (c == '\n')
+                        expected = Notation::Symbol::END_OF_LINE;
+                    CHECK(static_cast<Notation::Symbol>(symbols[c]) == expected);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Formatting a FrameSet and parsing it back gives the same game") {
+    GIVEN("10000 random games") {
+        const auto games = randomGames(10'000, 39);
+        WHEN("We format each one ball by ball and parse the finished game") {
+            const auto counterexample = FindCounterexample(games, [](const RandomGame& game) {
+                InlineFrameSet frameSet{};
+                for (auto i : game.balls) {
+                    frameSet.Bowled(PinSet{i});
+                    // Partial games format too; they just do not parse.
+                    if (Notation::Format(frameSet).empty())
+                        return false;
+                }
+                const auto text = Notation::Format(frameSet);
+                const auto parsed = Play(Notation::Parse(text));
+                return parsed.Score() == game.Score() && parsed.FrameScores() == frameSet.FrameScores() &&
+                       Notation::Format(parsed) == text;
+            });
+            THEN("Scores, frame scores and the text should survive the round trip") {
+                REQUIRE_FALSE(counterexample);
+            }
+        }
+    }
+    GIVEN("A game in progress") {
+        FrameSet frameSet{};
+        for (auto i : {0, 0b11'00'00'00'00, 0, 0b11'11'11'11'11})
+            frameSet.Bowled(PinSet{static_cast<uint_fast16_t>(i)});
+        THEN("Only the balls bowled so far are written") {
+            CHECK(Notation::Format(frameSet) == "X 8/ -");
+        }
+    }
+}
+
+SCENARIO("A stream parses games split across chunks at any point") {
+    GIVEN("300 random games as notation, one per line, with a blank line and no final newline") {
+        std::string text;
+        std::vector<std::string> lines;
+        const auto games = randomGames(300, 391);
+        for (std::size_t g = 0; g < games.size(); ++g) {
+            const auto game = games[g];
+            InlineFrameSet frameSet{};
+            for (auto i : game.balls)
+                frameSet.Bowled(PinSet{i});
+            lines.push_back(Notation::Format(frameSet));
+            text += lines.back() + (lines.size() == 150 ? "\r\n\n" : "\n");
+        }
+        text.pop_back();
+        const auto chunkSize = GENERATE(1u, 7u, 64u, 100'000u);
+        WHEN("We feed it " << chunkSize << " bytes at a time") {
+            NotationStream stream;
+            std::vector<std::string> parsed;
+            const auto collect = [&](std::span<const NotationGame> games) {
+                for (const auto& game : games)
+                    parsed.push_back(Notation::Format(Play(game)));
+            };
+            for (std::size_t i = 0; i < text.size(); i += chunkSize)
+                collect(stream.Feed(std::string_view{text}.substr(i, chunkSize)));
+            collect(stream.Finish());
+            THEN("Every game comes out once, in order") {
+                CHECK(parsed == lines);
+            }
+        }
+    }
+}
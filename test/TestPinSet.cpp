@@ -2,6 +2,12 @@
 
 #include "PinSet.h"
 
+#include "mock/MockPinSet.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
 SCENARIO("Default-constructed PinSet has all pins standing") {
     GIVEN("A default constructed PinSet class") {
         const PinSet pins;
@@ -168,3 +174,58 @@ SCENARIO("A PinSet correctly resets its state") {
         }
     }
 }
+
+SCENARIO("Combining a PinSet with another kind of IPinSet asks it about each pin") {
+    GIVEN("A PinSet and a mock pin set with the 7 and 10 pins down") {
+        PinSet pins;
+        MockPinSet ball;
+        ALLOW_CALL(ball, IsDown(ANY(Pin))).RETURN(_1 == Pin::SEVEN || _1 == Pin::TEN);
+        WHEN("We combine them") {
+            pins &= ball;
+            THEN("Exactly those two pins should be down") {
+                REQUIRE(pins.PinsDown() == 2);
+                REQUIRE(pins.IsDown(Pin::SEVEN));
+                REQUIRE(pins.IsDown(Pin::TEN));
+            }
+        }
+    }
+}
+
+SCENARIO("Bulk pin operations match the single-rack operations") {
+    GIVEN("1000 racks and balls as random masks, and the same as PinSets") {
+        std::mt19937_64 rng{37};
+        std::vector<uint16_t> racks(1000), balls(1000);
+        std::vector<PinSet> rackSets(1000), ballSets(1000);
+        for (std::size_t i = 0; i < racks.size(); ++i) {
+            racks[i] = static_cast<uint16_t>(rng() & 0x3FF);
+            balls[i] = static_cast<uint16_t>(rng() & 0x3FF);
+            for (auto pin = 0; pin < 10; ++pin) {
+                if (!(racks[i] & (1u << pin)))
+                    rackSets[i].KnockDownPin(static_cast<Pin>(pin));
+                if (!(balls[i] & (1u << pin)))
+                    ballSets[i].KnockDownPin(static_cast<Pin>(pin));
+            }
+        }
+        WHEN("We combine them in bulk and one at a time, then count the pins up") {
+            PinSet::AndAll(racks, balls);
+            std::vector<uint8_t> counts(racks.size());
+            PinSet::PopcountAll(racks, counts);
+            auto mismatches = 0;
+            for (std::size_t i = 0; i < racks.size(); ++i) {
+                rackSets[i] &= ballSets[i];
+                if (rackSets[i].Mask() != racks[i] || rackSets[i].PinsUp() != counts[i])
+                    ++mismatches;
+            }
+            THEN("Every rack should agree") {
+                REQUIRE(mismatches == 0);
+            }
+            AND_WHEN("We reset them all") {
+                PinSet::ResetAll(racks);
+                PinSet::PopcountAll(racks, counts);
+                THEN("Every rack should have all ten pins up") {
+                    REQUIRE(std::count(counts.begin(), counts.end(), 10) == 1000);
+                }
+            }
+        }
+    }
+}
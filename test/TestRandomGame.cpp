@@ -0,0 +1,126 @@
+#include "catch.hpp"
+
+#include "generator/RandomGame.h"
+
+#include "FrameSet.h"
+#include "GameArena.h"
+#include "GameBatch.h"
+#include "PinSet.h"
+
+#include <algorithm>
+#include <vector>
+
+SCENARIO("Random games only knock down standing pins and end exactly on their last ball") {
+    GIVEN("10000 random games") {
+        const auto games = randomGames(10'000, 35);
+        WHEN("We bowl each one into a FrameSet") {
+            const auto counterexample = FindCounterexample(games, [](const RandomGame& game) {
+                ReferenceScorer reference;
+                FrameSet frameSet{};
+                for (auto i : game.balls) {
+                    if (frameSet.Ended() || (i & ~reference.StandingMask()))
+                        return false;
+                    frameSet.Bowled(PinSet{i});
+                    reference.Bowl(i);
+                }
+                return frameSet.Ended() && game.balls.size() >= 11 && game.balls.size() <= 21;
+            });
+            THEN("Every game should be legal and complete") {
+                REQUIRE_FALSE(counterexample);
+            }
+        }
+    }
+}
+
+SCENARIO("A million random games keep GameBatch scores monotonic, at most 300 and correct") {
+    GIVEN("A million random games") {
+        constexpr std::size_t games = 1'000'000;
+        constexpr std::size_t chunk = 1 << 16;
+        const auto generator = randomGames(games, 1);
+        WHEN("We bowl them a chunk at a time, a ball for every game per pass") {
+            std::vector<RandomGame> chunkGames;
+            std::vector<PinMask> balls;
+            std::vector<uint16_t> scores, previous;
+            auto failures = 0;
+            for (std::size_t first = 0; first < games; first += chunk) {
+                const auto count = std::min(chunk, games - first);
+                chunkGames.clear();
+                for (std::size_t i = 0; i < count; ++i)
+                    chunkGames.push_back(generator[first + i]);
+                GameBatch batch{count};
+                balls.assign(count, 0);
+                scores.assign(count, 0);
+                previous.assign(count, 0);
+                for (std::size_t ball = 0; ball < 21; ++ball) {
+                    for (std::size_t i = 0; i < count; ++i)
+                        balls[i] = ball < chunkGames[i].balls.size() ? chunkGames[i].balls[ball] : 0x3FF;
+                    batch.BowlAll(balls);
+                    batch.ScoreAll(scores);
+                    for (std::size_t i = 0; i < count; ++i) {
+                        if (scores[i] < previous[i] || scores[i] > 300 ||
+                            batch.Ended(i) != (ball + 1 >= chunkGames[i].balls.size()))
+                            ++failures;
+                        previous[i] = scores[i];
+                    }
+                }
+                for (std::size_t i = 0; i < count; ++i)
+                    if (scores[i] != chunkGames[i].Score())
+                        ++failures;
+            }
+            THEN("No game should break an invariant") {
+                REQUIRE(failures == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("FrameSet scores random games monotonically, within 300 and like the reference") {
+    GIVEN("100000 random games and an arena") {
+        const auto games = randomGames(100'000, 350);
+        GameArena arena{1};
+        WHEN("We bowl every game and read the scoreboard after every ball") {
+            const auto counterexample = FindCounterexample(games, [&](const RandomGame& game) {
+                auto holds = true;
+                {
+                    FrameSet frameSet{arena.Resource()};
+                    uint_fast16_t previous = 0;
+                    for (auto i : game.balls) {
+                        frameSet.Bowled(PinSet{i});
+                        const auto score = frameSet.FrameScores().back();
+                        holds = holds && score >= previous && score <= 300;
+                        previous = score;
+                    }
+                    holds = holds && frameSet.Score() == game.Score();
+                }
+                arena.Reset();
+                return holds;
+            });
+            THEN("The property should hold for all of them") {
+                REQUIRE_FALSE(counterexample);
+            }
+        }
+    }
+}
+
+SCENARIO("A failing property is shrunk to a simpler game that still fails") {
+    GIVEN("A property most random games break") {
+        const auto holds = [](const RandomGame& game) {
+            return game.Score() < 100;
+        };
+        WHEN("We search random games for a counterexample") {
+            const auto games = randomGames(1'000, 7);
+            std::size_t first = 0;
+            while (holds(games[first]))
+                ++first;
+            const auto counterexample = FindCounterexample(games, holds);
+            THEN("The shrunk game should still fail, be simpler and sit right at the boundary") {
+                REQUIRE(counterexample);
+                CAPTURE(*counterexample);
+                CHECK_FALSE(holds(*counterexample));
+                CHECK(counterexample->PinsKnocked() < games[first].PinsKnocked());
+                CHECK(counterexample->Score() < games[first].Score());
+                CHECK(counterexample->Score() <= 102);
+            }
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#include "catch.hpp"
+
+#include "generator/ClearingBowler.h"
+
+#include "RareEvent.h"
+#include "SkillModel.h"
+#include "WinProbability.h"
+
+#include <cmath>
+#include <vector>
+
+// The chance three games total at least threshold, from one game's distribution.
+static double SeriesAtLeast(const WinProbability::Distribution& game, std::size_t threshold) {
+    std::vector<double> two(601), three(901);
+    for (std::size_t i = 0; i <= 300; ++i)
+        for (std::size_t j = 0; j <= 300; ++j)
+            two[i + j] += game[i] * game[j];
+    for (std::size_t i = 0; i <= 600; ++i)
+        for (std::size_t j = 0; j <= 300; ++j)
+            three[i + j] += two[i] * game[j];
+    double result = 0;
+    for (auto i = threshold; i < three.size(); ++i)
+        result += three[i];
+    return result;
+}
+
+SCENARIO("A perfect game from uniform balls is estimated from a few thousand games") {
+    GIVEN("Simulation's uniform balls, where a perfect game has a chance of 11^-12") {
+        const RareEvent event;
+        const auto exact = std::pow(11.0, -12);
+        const auto method = GENERATE(RareEventMethod::IMPORTANCE_SAMPLING, RareEventMethod::SPLITTING);
+        WHEN("We estimate it by " << (method == RareEventMethod::SPLITTING ? "splitting" : "importance sampling")) {
+            const auto estimate = event.Estimate({method, 1, 300, 2'000, 47});
+            THEN("The exact value is within four standard errors, which are small") {
+                CHECK(std::abs(estimate.probability - exact) < 4 * estimate.standardError);
+                CHECK(estimate.standardError < 0.2 * exact);
+                CHECK(estimate.games < 1e6);
+                CHECK(estimate.naiveGames > 1e12);
+            }
+        }
+    }
+    GIVEN("Importance sampling with the bias at the bowler's own strike rate") {
+        const auto estimate = RareEvent{}.Estimate({RareEventMethod::IMPORTANCE_SAMPLING, 1, 300, 2'000, 47, 0});
+        THEN("It is plain Monte Carlo and sees nothing") {
+            CHECK(estimate.probability == 0);
+            CHECK(estimate.high == 0);
+        }
+    }
+}
+
+SCENARIO("Estimates for a fitted bowler agree with the exact score distribution") {
+    GIVEN("A strong bowler and their exact final score distribution") {
+        // Strikes on six first balls in ten and converts every other leave.
+        const auto model = FitClearingBowler(4'000, 6, 5, 47);
+        const auto& bowler = model.Find(1);
+        const RareEvent event{model, bowler};
+        const auto game = WinProbability{model, bowler, bowler}.FinalScore(0);
+        CHECK(event.Base(10) == model.Pinfall(bowler, 10));
+
+        const auto method = GENERATE(RareEventMethod::IMPORTANCE_SAMPLING, RareEventMethod::SPLITTING);
+        WHEN("We estimate a perfect game by " << (method == RareEventMethod::SPLITTING ? "splitting" : "importance sampling")) {
+            const auto estimate = event.Estimate({method, 1, 300, 2'000, 470, 0.97});
+            THEN("The exact chance is within four standard errors") {
+                CHECK(std::abs(estimate.probability - game[300]) < 4 * estimate.standardError);
+                CHECK(estimate.low <= estimate.probability);
+                CHECK(estimate.high >= estimate.probability);
+            }
+        }
+        WHEN("We estimate an 800 series by " << (method == RareEventMethod::SPLITTING ? "splitting" : "importance sampling")) {
+            const auto exact = SeriesAtLeast(game, 800);
+            const auto estimate = event.Estimate({method, 3, 800, 5'000, 471, 0.9});
+            THEN("The exact chance is within four standard errors, with fewer games than plain Monte Carlo") {
+                CHECK(std::abs(estimate.probability - exact) < 4 * estimate.standardError);
+                CHECK(estimate.standardError < 0.2 * exact);
+                CHECK(estimate.naiveGames > 5 * estimate.games);
+            }
+        }
+    }
+}
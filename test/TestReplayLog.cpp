@@ -0,0 +1,125 @@
+#include "catch.hpp"
+
+#include "generator/RandomGame.h"
+
+#include "FrameSet.h"
+#include "PinSet.h"
+#include "ReplayLog.h"
+
+#include <sstream>
+#include <string>
+
+static std::string Record(std::size_t games, uint64_t seed) {
+    std::ostringstream out;
+    {
+        ReplayRecorder recorder{out, seed};
+        const auto generator = randomGames(games, seed);
+        for (std::size_t i = 0; i < generator.size(); ++i) {
+            recorder.StartGame();
+            InlineFrameSet frameSet{};
+            for (auto ball : generator[i].balls)
+                recorder.Bowled(frameSet, PinSet{ball});
+        }
+    }
+    return out.str();
+}
+
+static ReplayEntry& EntryAt(std::string& log, std::size_t ball) {
+    return *reinterpret_cast<ReplayEntry*>(log.data() + sizeof(ReplayHeader) + ball * sizeof(ReplayEntry));
+}
+
+SCENARIO("A replay log reproduces every score it recorded") {
+    GIVEN("A log of 5000 random games played on InlineFrameSets") {
+        const auto log = Record(5'000, 43);
+        WHEN("We replay it through FrameSet") {
+            std::istringstream in{log};
+            const auto result = ReplayLog::Replay(in);
+            THEN("Every ball matches") {
+                CHECK_FALSE(result.diverged);
+                CHECK(result.seed == 43);
+                CHECK(result.games == 5'000);
+                CHECK(result.balls == (log.size() - sizeof(ReplayHeader)) / sizeof(ReplayEntry));
+            }
+        }
+    }
+}
+
+SCENARIO("Replay stops at the first ball that does not match") {
+    GIVEN("A log of 100 games") {
+        auto log = Record(100, 431);
+        const auto ball = GENERATE(0u, 1u, 777u, 1500u);
+        WHEN("The check of ball " << ball << " is changed") {
+            EntryAt(log, ball).check ^= 1;
+            std::istringstream in{log};
+            const auto result = ReplayLog::Replay(in);
+            THEN("Replay reports that ball and its game") {
+                REQUIRE(result.diverged);
+                CHECK(result.divergedBall == ball);
+                CHECK(result.balls == ball);
+                CHECK(result.actual == (result.expected ^ 1));
+            }
+        }
+        WHEN("The running score logged on the ball that ends the third frame is one higher") {
+            auto corrupted = 0u;
+            while ((EntryAt(log, corrupted).check & 0xF) != 3)
+                ++corrupted;
+            EntryAt(log, corrupted).check += ReplayEntry::Check(0, 1);
+            std::istringstream in{log};
+            const auto result = ReplayLog::Replay(in);
+            THEN("Replay stops at that ball, before the game ends") {
+                REQUIRE(result.diverged);
+                CHECK(result.divergedBall == corrupted);
+                CHECK(result.divergedGame == 0);
+                CHECK(result.expected == result.actual + ReplayEntry::Check(0, 1));
+            }
+        }
+        WHEN("A game's first ball is marked as part of the game before") {
+            auto second = 1u;
+            while (!(EntryAt(log, second).ball & ReplayEntry::newGame))
+                ++second;
+            EntryAt(log, second).ball &= ~ReplayEntry::newGame;
+            std::istringstream in{log};
+            const auto result = ReplayLog::Replay(in);
+            THEN("The ball after the end of the first game diverges") {
+                REQUIRE(result.diverged);
+                CHECK(result.divergedBall == second);
+                CHECK(result.divergedGame == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("Logs from other formats or rules are refused") {
+    GIVEN("A log recorded under another rule version and a file that is not a log") {
+        auto log = Record(1, 1);
+        reinterpret_cast<ReplayHeader*>(log.data())->ruleVersion = ReplayRecorder::ruleVersion + 1;
+        std::istringstream otherRules{log};
+        std::istringstream notALog{"X 9/ 8- -7 X X 45 F/ 9- XX7 and some more padding"};
+        THEN("Replay throws") {
+            REQUIRE_THROWS_AS(ReplayLog::Replay(otherRules), ReplayException);
+            REQUIRE_THROWS_AS(ReplayLog::Replay(notALog), ReplayException);
+        }
+    }
+}
+
+SCENARIO("A replay log is little endian whatever the machine") {
+    GIVEN("A log of one perfect game") {
+        std::ostringstream out;
+        {
+            ReplayRecorder recorder{out, 0x0102};
+            InlineFrameSet frameSet{};
+            while (!frameSet.Ended())
+                recorder.Bowled(frameSet, PinSet{0});
+        }
+        const auto log = out.str();
+        THEN("The header's numbers and each ball are stored low byte first") {
+            REQUIRE(log.size() == sizeof(ReplayHeader) + 12 * sizeof(ReplayEntry));
+            CHECK(log[8] == ReplayHeader::currentVersion);
+            CHECK(log[9] == 0);
+            CHECK(log[16] == 0x02);
+            CHECK(log[17] == 0x01);
+            CHECK(log[sizeof(ReplayHeader)] == 0);
+            CHECK(static_cast<uint8_t>(log[sizeof(ReplayHeader) + 1]) == ReplayEntry::newGame >> 8);
+        }
+    }
+}
@@ -0,0 +1,78 @@
+#include "catch.hpp"
+
+#include "generator/RandomGame.h"
+
+#include "Archive.h"
+#include "RescorePipeline.h"
+
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
+
+SCENARIO("Rescoring an archive fixes wrong stored scores and keeps record order") {
+    GIVEN("An archive of random games where every seventh stored score is off by one") {
+        const auto directory = std::filesystem::temp_directory_path();
+        const auto inputPath = (directory / "TestRescoreInput.bwl").string();
+        const auto outputPath = (directory / "TestRescoreOutput.bwl").string();
+        constexpr std::size_t games = 20'000;
+        const auto generator = randomGames(games, 36);
+        std::vector<int> scores;
+        {
+            ArchiveWriter writer{inputPath};
+            for (std::size_t i = 0; i < games; ++i) {
+                const auto game = generator[i];
+                ArchiveRecord record;
+                record.gameId = i;
+                record.bowlerId = static_cast<uint32_t>(i % 13);
+                record.ballCount = static_cast<uint8_t>(game.balls.size());
+                std::copy(game.balls.begin(), game.balls.end(), record.balls.begin());
+                scores.push_back(game.Score());
+                record.storedScore = static_cast<uint16_t>(scores.back() + (i % 7 == 0));
+                writer.Write({&record, 1});
+            }
+            ArchiveRecord truncated;
+            truncated.gameId = games;
+            truncated.ballCount = 3;
+            writer.Write({&truncated, 1});
+        }
+
+        const auto engine = GENERATE(values({RescoreEngine::FRAMESET, RescoreEngine::BATCH}));
+        WHEN("We rescore it with small chunks, several threads per stage and little room in flight") {
+            RescorePipeline::Options options;
+            options.engine = engine;
+            options.chunkRecords = 333;
+            options.queueCapacity = 2;
+            options.maxChunksInFlight = 4;
+            options.decodeThreads = 2;
+            options.scoreThreads = 3;
+            options.diffThreads = 2;
+            std::ostringstream diff;
+            RescoreProgress result;
+            {
+                const ArchiveReader input{inputPath};
+                ArchiveWriter output{outputPath};
+                result = RescorePipeline{options}.Run(input, output, &diff);
+            }
+            THEN("Every wrong score should be fixed, in order, and reported") {
+                CHECK(result.records == games + 1);
+                CHECK(result.changed == (games + 6) / 7);
+                CHECK(result.invalid == 1);
+                const ArchiveReader output{outputPath};
+                REQUIRE(output.Records().size() == games + 1);
+                auto wrong = 0;
+                for (std::size_t i = 0; i < games; ++i)
+                    if (output.Records()[i].gameId != i || output.Records()[i].storedScore != scores[i])
+                        ++wrong;
+                CHECK(wrong == 0);
+                CHECK(output.Records()[games].ballCount == 3);
+                std::istringstream lines{diff.str()};
+                std::string first;
+                std::getline(lines, first);
+                CHECK(first == "0,0," + std::to_string(scores[0] + 1) + "," + std::to_string(scores[0]));
+            }
+        }
+        std::filesystem::remove(inputPath);
+        std::filesystem::remove(outputPath);
+    }
+}
@@ -0,0 +1,184 @@
+#include "catch.hpp"
+
+#include "generator/RandomGame.h"
+
+#include "FrameSet.h"
+#include "PinSet.h"
+#include "ScoreHistogram.h"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+SCENARIO("Percentiles are read off by nearest rank") {
+    GIVEN("Ten games scoring 100, 110, ... 190") {
+        Histogram histogram;
+        for (auto score = 100; score < 200; score += 10)
+            histogram.Add(score);
+        THEN("The total, mean and percentiles follow") {
+            CHECK(histogram.Total() == 10);
+            CHECK(histogram.Mean() == Approx(145));
+            CHECK(histogram.Percentile(0) == 100);
+            CHECK(histogram.Percentile(0.1) == 100);
+            CHECK(histogram.Percentile(0.11) == 110);
+            CHECK(histogram.Percentile(0.5) == 140);
+            CHECK(histogram.Percentile(0.95) == 190);
+            CHECK(histogram.Percentile(1) == 190);
+        }
+        THEN("A fraction outside 0 to 1 is rejected") {
+            CHECK_THROWS_AS(histogram.Percentile(-0.1), std::invalid_argument);
+            CHECK_THROWS_AS(histogram.Percentile(1.5), std::invalid_argument);
+        }
+        THEN("A score over 300 is rejected and counts nowhere") {
+            CHECK_THROWS_AS(histogram.Add(301), std::out_of_range);
+            CHECK_THROWS_AS(ScoreHistogram{}.Add(1'000), std::out_of_range);
+            CHECK(histogram.Total() == 10);
+        }
+    }
+    GIVEN("An empty histogram") {
+        THEN("Every percentile is 0") {
+            CHECK(Histogram{}.Percentile(0.5) == 0);
+        }
+    }
+}
+
+SCENARIO("Games are counted by final, frame and bowler score") {
+    GIVEN("A histogram with frames and two bowlers") {
+        ScoreHistogram histogram{{true, 2}};
+        WHEN("Bowler 1 bowls a perfect game and bowler 0 all nines") {
+            InlineFrameSet perfect{};
+            while (!perfect.Ended())
+                perfect.Bowled(PinSet{0});
+            histogram.Add(perfect, 1);
+            InlineFrameSet nines{};
+            while (!nines.Ended())
+                nines.Bowled(PinSet{1});
+            histogram.Add(nines, 0);
+            histogram.Add(123, 7);
+            THEN("Each goes to its own bins") {
+                CHECK(histogram.Games().Total() == 3);
+                CHECK(histogram.Games().counts[300] == 1);
+                CHECK(histogram.Games().counts[90] == 1);
+                CHECK(histogram.Games().counts[123] == 1);
+                CHECK(histogram.Bowler(1).counts[300] == 1);
+                CHECK(histogram.Bowler(0).counts[90] == 1);
+                CHECK(histogram.Bowler(0).Total() == 1);
+                for (uint_fast8_t frame = 0; frame < 10; ++frame) {
+                    CHECK(histogram.Frame(frame).counts[30 * (frame + 1)] == 1);
+                    CHECK(histogram.Frame(frame).counts[9 * (frame + 1)] == 1);
+                }
+                CHECK_THROWS_AS(histogram.Bowler(2), std::out_of_range);
+            }
+        }
+    }
+}
+
+SCENARIO("Per-thread shards merge to the single-threaded histogram") {
+    GIVEN("2000 random games") {
+        const auto generator = randomGames(2'000, 44);
+        std::vector<InlineFrameSet> games(generator.size());
+        for (std::size_t i = 0; i < generator.size(); ++i)
+            for (auto ball : generator[i].balls)
+                games[i].Bowled(PinSet{ball});
+        ScoreHistogram expected{{true, 5}};
+        for (std::size_t i = 0; i < games.size(); ++i)
+            expected.Add(games[i], static_cast<uint32_t>(i % 5));
+
+        const auto threads = GENERATE(1u, 4u);
+        WHEN("They are collected on " << threads << " threads") {
+            ScoreCollector collector{threads, {true, 5}};
+            std::vector<std::thread> workers;
+            for (unsigned t = 0; t < threads; ++t)
+                workers.emplace_back([&, t] {
+                    auto& shard = collector.Shard(t);
+                    for (auto i = t; i < games.size(); i += threads)
+                        shard.Add(games[i], i % 5);
+                });
+            for (auto& i : workers)
+                i.join();
+            const auto merged = collector.Merge();
+            THEN("Every bin matches") {
+                CHECK(merged.Games().counts == expected.Games().counts);
+                for (uint_fast8_t frame = 0; frame < 10; ++frame)
+                    CHECK(merged.Frame(frame).counts == expected.Frame(frame).counts);
+                for (uint32_t bowler = 0; bowler < 5; ++bowler)
+                    CHECK(merged.Bowler(bowler).counts == expected.Bowler(bowler).counts);
+            }
+        }
+    }
+}
+
+SCENARIO("Histograms are exported as CSV and binary") {
+    GIVEN("A histogram with frames and one bowler") {
+        ScoreHistogram histogram{{true, 1}};
+        const auto generator = randomGames(300, 440);
+        for (std::size_t i = 0; i < generator.size(); ++i) {
+            FrameSet frameSet;
+            for (auto ball : generator[i].balls)
+                frameSet.Bowled(PinSet{ball});
+            histogram.Add(frameSet);
+        }
+        WHEN("We write it as CSV") {
+            std::ostringstream out;
+            histogram.WriteCsv(out);
+            const auto csv = out.str();
+            THEN("There is a header and one row per score with a column per histogram") {
+                CHECK(csv.rfind("score,games,frame1,", 0) == 0);
+                CHECK(std::count(csv.begin(), csv.end(), '\n') == 302);
+                CHECK(std::count(csv.begin(), csv.end(), ',') == 302 * 12);
+            }
+        }
+        WHEN("We save and load it") {
+            std::stringstream file;
+            histogram.Save(file);
+            const auto loaded = ScoreHistogram::Load(file);
+            THEN("It comes back the same") {
+                CHECK(loaded.PerFrame());
+                CHECK(loaded.Bowlers() == 1);
+                CHECK(loaded.Games().counts == histogram.Games().counts);
+                CHECK(loaded.Frame(4).counts == histogram.Frame(4).counts);
+                CHECK(loaded.Bowler(0).counts == histogram.Bowler(0).counts);
+            }
+        }
+        WHEN("We load something that is not a histogram or is cut short") {
+            std::stringstream file;
+            histogram.Save(file);
+            std::istringstream truncated{file.str().substr(0, 1000)};
+            std::istringstream garbage{std::string(64, 'x')};
+            ScoreHistogramHeader header;
+            header.bowlers = 0xFFFF'FFFF;
+            std::istringstream huge{std::string(reinterpret_cast<const char*>(&header), sizeof(header)) +
+                                    file.str().substr(sizeof(header))};
+            THEN("Load throws") {
+                CHECK_THROWS_AS(ScoreHistogram::Load(truncated), ScoreHistogramException);
+                CHECK_THROWS_AS(ScoreHistogram::Load(garbage), ScoreHistogramException);
+                CHECK_THROWS_AS(ScoreHistogram::Load(huge), ScoreHistogramException);
+            }
+        }
+    }
+    GIVEN("A histogram of one game of 300") {
+        ScoreHistogram histogram;
+        histogram.Add(300);
+        std::ostringstream out;
+        histogram.Save(out);
+        const auto file = out.str();
+        THEN("The header's numbers and the counts are stored low byte first") {
+            REQUIRE(file.size() == sizeof(ScoreHistogramHeader) + sizeof(Histogram::counts));
+            CHECK(file[8] == ScoreHistogramHeader::currentVersion);
+            CHECK(file[9] == 0);
+            CHECK(file[12] == static_cast<char>(Histogram::bins & 0xFF));
+            CHECK(file[13] == Histogram::bins >> 8);
+            const auto count = sizeof(ScoreHistogramHeader) + 300 * sizeof(uint64_t);
+            CHECK(file[count] == 1);
+            CHECK(std::all_of(file.begin() + count + 1, file.begin() + count + 8, [](char c) { return c == 0; }));
+        }
+    }
+    GIVEN("Histograms of different shapes") {
+        ScoreHistogram withFrames{{true, 0}};
+        THEN("They cannot be merged") {
+            CHECK_THROWS_AS(withFrames.Merge(ScoreHistogram{}), ScoreHistogramException);
+        }
+    }
+}
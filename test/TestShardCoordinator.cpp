@@ -0,0 +1,137 @@
+#include "catch.hpp"
+
+#include "ShardCoordinator.h"
+
+#include <csignal>
+#include <random>
+#include <stdexcept>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+// The same chunks played one after another in this process.
+static ShardResults PlayInProcess(const Simulation& simulation, const ShardCoordinator::Options& options) {
+    ShardResults results;
+    for (uint64_t chunk = 0; chunk * options.chunkGames < options.games; ++chunk) {
+        auto rng = ShardCoordinator::ChunkRng(options.seed, chunk);
+        const auto games = std::min(options.chunkGames, options.games - chunk * options.chunkGames);
+        simulation.Play(options.engine, games, rng, [&](uint_fast16_t score) {
+            results.totals.Add(score);
+            results.histogram.Add(score);
+        });
+    }
+    return results;
+}
+
+SCENARIO("Forked workers play the same games whatever their number") {
+    GIVEN("A simulation cut into chunks, the last one short") {
+        const Simulation simulation;
+        ShardCoordinator::Options options;
+        options.games = 10'500;
+        options.chunkGames = 1'000;
+        const auto expected = PlayInProcess(simulation, options);
+        REQUIRE(expected.totals.games == 10'500);
+
+        const auto workers = GENERATE(1u, 3u, 4u, 20u);
+        WHEN("We play it on " << workers << " workers") {
+            options.workers = workers;
+            const ShardCoordinator coordinator{simulation, options};
+            const auto results = coordinator.Run();
+            THEN("The histogram and totals match, with every chunk played once") {
+                CHECK(results.histogram.counts == expected.histogram.counts);
+                CHECK(results.totals.games == expected.totals.games);
+                CHECK(results.totals.total == expected.totals.total);
+                CHECK(results.totals.best == expected.totals.best);
+                CHECK(results.shards.size() == std::min(workers, 11u));
+                uint64_t chunks = 0;
+                for (const auto& shard : results.shards) {
+                    CHECK(shard.firstChunk == chunks);
+                    chunks += shard.chunks;
+                }
+                CHECK(chunks == coordinator.Chunks());
+                CHECK(results.Restarts() == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("Chunks are seeded from the seed and the chunk together") {
+    GIVEN("Two runs whose seeds differ by one") {
+        THEN("The next chunk of the first does not replay a chunk of the second") {
+            auto first = ShardCoordinator::ChunkRng(48, 1);
+            auto second = ShardCoordinator::ChunkRng(49, 0);
+            CHECK(first() != second());
+            CHECK(ShardCoordinator::ChunkRng(48, 1)() == ShardCoordinator::ChunkRng(48, 1)());
+        }
+    }
+}
+
+SCENARIO("Only the workers are reaped") {
+    GIVEN("A child of this process that is not a worker") {
+        const auto child = fork();
+        REQUIRE(child >= 0);
+        if (child == 0)
+            _exit(7);
+        WHEN("We run the coordinator") {
+            const Simulation simulation;
+            ShardCoordinator::Options options;
+            options.workers = 2;
+            options.games = 2'000;
+            options.chunkGames = 500;
+            const ShardCoordinator coordinator{simulation, options};
+            const auto results = coordinator.Run();
+            THEN("The child is still there to be waited for") {
+                CHECK(results.totals.games == 2'000);
+                int status = 0;
+                REQUIRE(waitpid(child, &status, 0) == child);
+                CHECK(WEXITSTATUS(status) == 7);
+            }
+        }
+    }
+}
+
+SCENARIO("A worker that crashes is resumed from its last checkpoint") {
+    GIVEN("Three workers, one of which is killed partway through its shard") {
+        const Simulation simulation;
+        ShardCoordinator::Options options;
+        options.workers = 3;
+        options.games = 9'000;
+        options.chunkGames = 500;
+        const auto expected = PlayInProcess(simulation, options);
+        const ShardCoordinator coordinator{simulation, options, [](unsigned, uint64_t chunk, unsigned attempt) {
+            if (chunk == 8 && attempt == 0)
+                kill(getpid(), SIGKILL);
+        }};
+        WHEN("We run it") {
+            const auto results = coordinator.Run();
+            THEN("Its shard is forked again once and the results are unchanged") {
+                CHECK(results.histogram.counts == expected.histogram.counts);
+                CHECK(results.totals.total == expected.totals.total);
+                CHECK(results.shards[1].restarts == 1);
+                CHECK(results.Restarts() == 1);
+            }
+        }
+    }
+    GIVEN("A shard whose worker dies on every attempt") {
+        const Simulation simulation;
+        ShardCoordinator::Options options;
+        options.workers = 2;
+        options.games = 4'000;
+        options.chunkGames = 1'000;
+        options.maxRestarts = 2;
+        const ShardCoordinator coordinator{simulation, options, [](unsigned shard, uint64_t, unsigned) {
+            if (shard == 0)
+                throw std::runtime_error{"Worker failed"};
+        }};
+        THEN("Run gives up after the last restart") {
+            CHECK_THROWS_AS(coordinator.Run(), ShardCoordinatorException);
+        }
+    }
+    GIVEN("Options without workers") {
+        ShardCoordinator::Options options;
+        options.workers = 0;
+        THEN("The coordinator cannot be made") {
+            CHECK_THROWS_AS((ShardCoordinator{Simulation{}, options}), std::invalid_argument);
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#include "catch.hpp"
+
+#include "Simulation.h"
+
+#include <random>
+
+SCENARIO("Every engine plays the same games from the same seed") {
+    GIVEN("A simulation of uniform pinfalls") {
+        const Simulation simulation;
+        std::mt19937_64 rng{45};
+        const auto expected = simulation.Play(SimulationEngine::HEAP, 2'000, rng);
+        const auto engine = GENERATE(SimulationEngine::ARENA, SimulationEngine::INLINE);
+        WHEN("We play them on " << Simulation::Name(engine)) {
+            rng.seed(45);
+            const auto totals = simulation.Play(engine, 2'000, rng);
+            THEN("The totals match") {
+                CHECK(totals.games == 2'000);
+                CHECK(totals.total == expected.total);
+                CHECK(totals.best == expected.best);
+                CHECK(totals.Average() == Approx(expected.Average()));
+            }
+        }
+    }
+}
+
+SCENARIO("Totals from several threads merge") {
+    GIVEN("Two sets of totals") {
+        SimulationTotals first;
+        first.Add(100);
+        first.Add(200);
+        SimulationTotals second;
+        second.Add(300);
+        WHEN("We merge them") {
+            first.Merge(second);
+            THEN("Games and scores add up and the best is kept") {
+                CHECK(first.games == 3);
+                CHECK(first.total == 600);
+                CHECK(first.best == 300);
+                CHECK(first.Average() == Approx(200));
+            }
+        }
+    }
+}
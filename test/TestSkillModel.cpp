@@ -0,0 +1,166 @@
+#include "catch.hpp"
+
+#include "generator/RandomGame.h"
+
+#include "Archive.h"
+#include "FrameSet.h"
+#include "Simulation.h"
+#include "SkillModel.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+static ArchiveRecord ToRecord(uint32_t bowlerId, const std::vector<uint16_t>& balls) {
+    ArchiveRecord record;
+    record.bowlerId = bowlerId;
+    record.ballCount = static_cast<uint8_t>(balls.size());
+    std::copy(balls.begin(), balls.end(), record.balls.begin());
+    return record;
+}
+
+// Bowler 1 strikes every time. Bowler 2 always leaves the 10 pin and converts it in
+// every other frame, knocking nothing down when it misses; the game then ends 9-.
+static std::vector<ArchiveRecord> KnownArchive() {
+    constexpr uint16_t tenPin = 0b10'00'00'00'00;
+    std::vector<ArchiveRecord> records;
+    for (auto game = 0; game < 100; ++game) {
+        records.push_back(ToRecord(1, std::vector<uint16_t>(12, 0)));
+        std::vector<uint16_t> balls;
+        for (auto frame = 0; frame < 10; ++frame) {
+            balls.push_back(tenPin);
+            balls.push_back(frame % 2 ? tenPin : 0);
+        }
+        balls.push_back(tenPin);
+        balls.resize(20);
+        records.push_back(ToRecord(2, balls));
+    }
+    ArchiveRecord truncated = ToRecord(2, {0, 0, 0});
+    records.push_back(truncated);
+    return records;
+}
+
+SCENARIO("A skill model is fitted from archived games") {
+    GIVEN("An archive of two very different bowlers and a truncated game") {
+        const auto records = KnownArchive();
+        const auto threads = GENERATE(1u, 3u);
+        WHEN("We fit a model on " << threads << " threads") {
+            const auto model = SkillModel::Fit(records, threads);
+            THEN("Each bowler gets their own first ball and conversion rates") {
+                CHECK(model.GamesFitted() == 200);
+                REQUIRE(model.Bowlers().size() == 2);
+                const auto& striker = model.Find(1);
+                CHECK(striker.games == 100);
+                CHECK(striker.firstBall[9] == 0);
+                CHECK(striker.firstBall[10] == 65535);
+
+                const auto& spareShooter = model.Find(2);
+                CHECK(spareShooter.firstBall[8] == 0);
+                CHECK(spareShooter.firstBall[9] == 65535);
+                const auto singlePin = static_cast<std::size_t>(LeaveType::SINGLE_PIN);
+                CHECK(spareShooter.conversion[singlePin] == 32768);
+                CHECK(spareShooter.pinHit == 0);
+            }
+            THEN("An unknown bowler gets the pooled record") {
+                CHECK(&model.Find(3) == &model.Pooled());
+                CHECK(model.Pooled().games == 200);
+            }
+        }
+    }
+}
+
+SCENARIO("A skill model survives a save and load and samples legal balls") {
+    GIVEN("A model fitted on 20000 random games from 10 bowlers") {
+        const auto generator = randomGames(20'000, 40);
+        std::vector<ArchiveRecord> records;
+        for (std::size_t i = 0; i < generator.size(); ++i)
+            records.push_back(ToRecord(static_cast<uint32_t>(i % 10), generator[i].balls));
+        const auto model = SkillModel::Fit(records, 2);
+        REQUIRE(model.GamesFitted() == records.size());
+
+        WHEN("We save and load it") {
+            const auto path = (std::filesystem::temp_directory_path() / "TestSkillModel.bsm").string();
+            model.Save(path);
+            const auto loaded = SkillModel::Load(path);
+            THEN("Every record comes back") {
+                REQUIRE(loaded.Bowlers().size() == 10);
+                CHECK(loaded.GamesFitted() == model.GamesFitted());
+                for (std::size_t i = 0; i < 10; ++i) {
+                    CHECK(loaded.Bowlers()[i].firstBall == model.Bowlers()[i].firstBall);
+                    CHECK(loaded.Bowlers()[i].conversion == model.Bowlers()[i].conversion);
+                    CHECK(loaded.Bowlers()[i].pinHit == model.Bowlers()[i].pinHit);
+                }
+            }
+        }
+        WHEN("We play 2000 games by sampling a bowler") {
+            std::mt19937_64 rng{40};
+            const auto& bowler = model.Find(4);
+            auto illegal = 0;
+            uint64_t firstBalls = 0, strikes = 0;
+            for (auto game = 0; game < 2000; ++game) {
+                InlineFrameSet frameSet{};
+                Simulation::PlayRacks(frameSet, [&](uint16_t standing) {
+                    const auto after = model.Sample(bowler, standing, rng);
+                    illegal += (after & ~standing) != 0;
+                    if (standing == SkillModel::fullRack) {
+                        ++firstBalls;
+                        strikes += after == 0;
+                    }
+                    return after;
+                });
+            }
+            THEN("Balls only knock down standing pins and strikes come at the fitted rate") {
+                CHECK(illegal == 0);
+                const auto fitted = 1 - bowler.firstBall[9] / 65536.0;
+                CHECK(static_cast<double>(strikes) / firstBalls == Approx(fitted).margin(0.02));
+            }
+        }
+    }
+}
+
+SCENARIO("Loading something that is not a skill model fails") {
+    GIVEN("A file of text") {
+        const auto path = (std::filesystem::temp_directory_path() / "TestSkillModel.txt").string();
+        std::ofstream{path} << "X 9/ 8- -7 X X 45 F/ 9- XX7\n";
+        THEN("Load throws") {
+            REQUIRE_THROWS_AS(SkillModel::Load(path), SkillModelException);
+        }
+    }
+}
+
+SCENARIO("A skill model with a corrupt header or bowler table fails to load") {
+    GIVEN("A saved model of two bowlers") {
+        const auto path = (std::filesystem::temp_directory_path() / "TestSkillModelCorrupt.bsm").string();
+        SkillModel::Fit(KnownArchive(), 1).Save(path);
+        std::string file;
+        {
+            std::ifstream in{path, std::ios::binary};
+            file.assign(std::istreambuf_iterator<char>{in}, {});
+        }
+        const auto rewrite = [&] {
+            std::ofstream{path, std::ios::binary | std::ios::trunc}.write(file.data(), file.size());
+        };
+        WHEN("The header claims four billion bowlers") {
+            const uint32_t bowlers = 0xFFFF'FFFF;
+            std::memcpy(file.data() + offsetof(SkillModelHeader, bowlerCount), &bowlers, sizeof(bowlers));
+            rewrite();
+            THEN("Load throws rather than allocating for them") {
+                REQUIRE_THROWS_AS(SkillModel::Load(path), SkillModelException);
+            }
+        }
+        WHEN("The two bowler records are swapped") {
+            const auto last = file.size() - sizeof(SkillRecord);
+            std::swap_ranges(file.begin() + last - sizeof(SkillRecord), file.begin() + last, file.begin() + last);
+            rewrite();
+            THEN("Load throws, as Find could not search them") {
+                REQUIRE_THROWS_AS(SkillModel::Load(path), SkillModelException);
+            }
+        }
+    }
+}
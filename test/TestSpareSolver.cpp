@@ -0,0 +1,83 @@
+#include "catch.hpp"
+
+#include "AccuracyModel.h"
+#include "SpareSolver.h"
+
+static constexpr uint_fast16_t Standing(std::initializer_list<Pin> pins) {
+    uint_fast16_t mask = 0;
+    for (auto p : pins)
+        mask |= uint_fast16_t{1} << static_cast<uint8_t>(p);
+    return mask;
+}
+
+SCENARIO("A bowler who never misses should expect a perfect game") {
+    GIVEN("A solver for a perfectly accurate bowler") {
+        AccuracyModel model{1.0};
+        SpareSolver solver{model};
+        WHEN("We solve every state") {
+            solver.Solve();
+            THEN("The expected score should be 300 by aiming at the head pin") {
+                REQUIRE(solver.ExpectedScore() == Approx(300));
+                REQUIRE(solver.BestTarget(SpareSolver::State{}) == Pin::ONE);
+            }
+        }
+    }
+}
+
+SCENARIO("Pins behind the target fall with it, so the solver aims at the front pin") {
+    GIVEN("A solved table for a perfectly accurate bowler") {
+        AccuracyModel model{1.0};
+        SpareSolver solver{model};
+        solver.Solve(1);
+        WHEN("The 6-10 is left in the first frame") {
+            const SpareSolver::State state{0, 1, Standing({Pin::SIX, Pin::TEN})};
+            THEN("The 6 pin should be targeted") {
+                REQUIRE(solver.BestTarget(state) == Pin::SIX);
+            }
+        }
+    }
+}
+
+SCENARIO("A 7-10 can only ever yield one more pin") {
+    GIVEN("A solved table for a fairly accurate bowler") {
+        AccuracyModel model{0.8};
+        SpareSolver solver{model};
+        solver.Solve();
+        WHEN("The 7-10 is left in the fourth frame with no bonuses pending") {
+            const SpareSolver::State state{3, 1, Standing({Pin::SEVEN, Pin::TEN})};
+            const SpareSolver::State nextFrame{4, 0};
+            THEN("The value should be one pin at best on top of the next frame's value") {
+                const auto gained = solver.ExpectedScore(state) - solver.ExpectedScore(nextFrame);
+                REQUIRE(gained <= 1.0);
+                REQUIRE(gained == Approx(0.8));
+            }
+        }
+        WHEN("The same leave is shot while a strike bonus is pending") {
+            const SpareSolver::State plain{3, 1, Standing({Pin::TEN})};
+            const SpareSolver::State withBonus{3, 1, Standing({Pin::TEN}), 1};
+            THEN("The pin should be worth double") {
+                REQUIRE(solver.ExpectedScore(withBonus) - solver.ExpectedScore(plain) == Approx(0.8));
+            }
+        }
+    }
+}
+
+SCENARIO("Solving in parallel gives the same policy as solving on one thread") {
+    GIVEN("Two solvers for the same bowler") {
+        AccuracyModel model{0.6};
+        SpareSolver serial{model};
+        SpareSolver parallel{model};
+        WHEN("We solve one serially and one across several threads") {
+            serial.Solve(1);
+            parallel.Solve(4);
+            THEN("The expected scores and chosen targets should match") {
+                REQUIRE(serial.ExpectedScore() == parallel.ExpectedScore());
+                for (uint_fast16_t mask = 1; mask < 1024; mask += 37) {
+                    const SpareSolver::State state{9, 1, mask, 1, 0, true};
+                    REQUIRE(serial.BestTarget(state) == parallel.BestTarget(state));
+                    REQUIRE(serial.ExpectedScore(state) == parallel.ExpectedScore(state));
+                }
+            }
+        }
+    }
+}
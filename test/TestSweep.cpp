@@ -0,0 +1,175 @@
+#include "catch.hpp"
+
+#include "generator/ClearingBowler.h"
+
+#include "Simulation.h"
+#include "SkillModel.h"
+#include "Sweep.h"
+#include "WinProbability.h"
+
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+SCENARIO("A grid holds every combination of its values") {
+    GIVEN("Two strike deltas, three spare deltas and both tenth frame rules") {
+        SweepGrid grid{{0, 0.02}, {-0.1, 0, 0.1}, {true, false}};
+        THEN("There are twelve points, strike deltas outermost") {
+            const auto points = grid.Points();
+            REQUIRE(points.size() == 12);
+            CHECK(points[0].strikeDelta == 0);
+            CHECK(points[0].spareDelta == -0.1);
+            CHECK(points[0].rules.tenthFrameBonus);
+            CHECK_FALSE(points[1].rules.tenthFrameBonus);
+            CHECK(points[2].spareDelta == 0);
+            CHECK(points[11].strikeDelta == 0.02);
+            CHECK(points[11].spareDelta == 0.1);
+        }
+    }
+}
+
+SCENARIO("The exact sweep matches the existing engines at the unchanged point") {
+    GIVEN("A fitted bowler") {
+        // Strikes on four first balls in ten and converts every other leave.
+        const auto model = FitClearingBowler(2'000, 4, 5, 49);
+        const auto& bowler = model.Find(1);
+        const Sweep sweep{model, bowler};
+        WHEN("We work out the unchanged point") {
+            const auto result = sweep.Evaluate({}, {});
+            THEN("It has WinProbability's final score distribution") {
+                const auto game = WinProbability{model, bowler, bowler}.FinalScore(0);
+                double mean = 0;
+                for (std::size_t score = 0; score < game.size(); ++score)
+                    mean += game[score] * score;
+                CHECK(result.mean == Approx(mean));
+            }
+        }
+    }
+    GIVEN("Simulation's uniform balls") {
+        const Sweep sweep;
+        const auto exact = sweep.Evaluate({}, {});
+        WHEN("We play 100000 games of InlineFrameSet and simulate the same through the sweep") {
+            std::mt19937_64 rng{49};
+            const auto totals = Simulation{}.Play(SimulationEngine::INLINE, 100'000, rng);
+            Sweep::Options options;
+            options.method = SweepMethod::SIMULATION;
+            const auto simulated = sweep.Evaluate({}, options);
+            THEN("Both averages are within four standard errors of the exact mean") {
+                const auto error = exact.standardDeviation / std::sqrt(100'000.0);
+                CHECK(std::abs(totals.Average() - exact.mean) < 4 * error);
+                CHECK(std::abs(simulated.mean - exact.mean) < 4 * error);
+                CHECK(simulated.standardDeviation == Approx(exact.standardDeviation).epsilon(0.02));
+            }
+        }
+    }
+}
+
+SCENARIO("What-ifs move the scores the way they should") {
+    GIVEN("Simulation's uniform balls") {
+        const Sweep sweep;
+        const auto unchanged = sweep.Evaluate({}, {});
+        WHEN("Strikes and spares get more likely") {
+            const auto strikes = sweep.Evaluate({0.02, 0, {}}, {});
+            const auto spares = sweep.Evaluate({0, 0.02, {}}, {});
+            THEN("The mean goes up") {
+                CHECK(strikes.mean > unchanged.mean);
+                CHECK(spares.mean > unchanged.mean);
+            }
+        }
+        WHEN("Every ball is a strike") {
+            const auto withBonus = sweep.Evaluate({1, 0, {}}, {});
+            const auto withoutBonus = sweep.Evaluate({1, 0, {false}}, {});
+            THEN("The game is 300 with fill balls in the tenth and 270 without") {
+                CHECK(withBonus.mean == Approx(300));
+                CHECK(withBonus.standardDeviation == Approx(0).margin(1e-6));
+                CHECK(withoutBonus.mean == Approx(270));
+                CHECK(withoutBonus.median == 270);
+            }
+        }
+        WHEN("The tenth frame has no bonus balls") {
+            const auto result = sweep.Evaluate({0, 0, {false}}, {});
+            THEN("Scores go down") {
+                CHECK(result.mean < unchanged.mean);
+                CHECK(result.key != unchanged.key);
+            }
+        }
+    }
+}
+
+SCENARIO("Repeated sweeps come from the cache") {
+    GIVEN("A sweep over eight points and an empty cache") {
+        const Sweep sweep;
+        SweepGrid grid{{0, 0.02}, {0, 0.05}, {true, false}};
+        SweepCache cache;
+        Sweep::Options options;
+        options.threads = 3;
+        const auto first = sweep.Run(grid, options, &cache);
+        REQUIRE(first.size() == 8);
+        CHECK(cache.Size() == 8);
+        for (const auto& i : first)
+            CHECK_FALSE(i.cached);
+
+        WHEN("We extend the grid and run it again") {
+            grid.strikeDeltas.push_back(0.04);
+            const auto second = sweep.Run(grid, options, &cache);
+            THEN("Only the new points are worked out") {
+                REQUIRE(second.size() == 12);
+                for (std::size_t i = 0; i < 8; ++i) {
+                    CHECK(second[i].cached);
+                    CHECK(second[i].mean == first[i].mean);
+                }
+                for (std::size_t i = 8; i < 12; ++i)
+                    CHECK_FALSE(second[i].cached);
+                CHECK(cache.Size() == 12);
+            }
+        }
+        WHEN("We simulate instead") {
+            options.method = SweepMethod::SIMULATION;
+            options.games = 1'000;
+            const auto simulated = sweep.Run(grid, options, &cache);
+            THEN("Nothing is taken from the exact results") {
+                CHECK_FALSE(simulated[0].cached);
+                CHECK(simulated[0].key != first[0].key);
+                CHECK(cache.Size() == 16);
+            }
+        }
+        WHEN("We save the cache and load it back") {
+            const std::string path = "TestSweepCache.csv";
+            cache.Save(path);
+            auto loaded = SweepCache::Load(path);
+            std::remove(path.c_str());
+            THEN("Every result comes back as it was") {
+                REQUIRE(loaded.Size() == 8);
+                for (const auto& i : first) {
+                    const auto* found = loaded.Find(i.key);
+                    REQUIRE(found);
+                    CHECK(found->mean == i.mean);
+                    CHECK(found->standardDeviation == i.standardDeviation);
+                    CHECK(found->atLeast200 == i.atLeast200);
+                    CHECK(found->median == i.median);
+                    CHECK(found->point.rules.tenthFrameBonus == i.point.rules.tenthFrameBonus);
+                }
+            }
+        }
+        WHEN("We write the results table") {
+            std::ostringstream out;
+            Sweep::WriteTable(out, first);
+            THEN("It has a header and a row per point") {
+                std::istringstream in{out.str()};
+                std::string line;
+                auto lines = 0;
+                while (std::getline(in, line))
+                    ++lines;
+                CHECK(lines == 9);
+                CHECK(out.str().rfind("strikeDelta,spareDelta,tenthFrameBonus,mean", 0) == 0);
+            }
+        }
+    }
+    GIVEN("A cache file that does not exist") {
+        THEN("It loads as an empty cache") {
+            CHECK(SweepCache::Load("TestSweepMissing.csv").Size() == 0);
+        }
+    }
+}
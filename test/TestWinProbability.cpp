@@ -0,0 +1,125 @@
+#include "catch.hpp"
+
+#include "generator/RandomGame.h"
+
+#include "Archive.h"
+#include "FrameSet.h"
+#include "PinSet.h"
+#include "SkillModel.h"
+#include "WinProbability.h"
+
+#include <random>
+#include <vector>
+
+static SkillModel FitRandomBowlers(std::size_t games, uint64_t seed) {
+    const auto generator = randomGames(games, seed);
+    std::vector<ArchiveRecord> records;
+    for (std::size_t i = 0; i < generator.size(); ++i) {
+        const auto game = generator[i];
+        ArchiveRecord record;
+        record.bowlerId = static_cast<uint32_t>(i % 2);
+        record.ballCount = static_cast<uint8_t>(game.balls.size());
+        std::copy(game.balls.begin(), game.balls.end(), record.balls.begin());
+        records.push_back(record);
+    }
+    return SkillModel::Fit(records, 1);
+}
+
+// Plays out a game from its current rack with the model's sampler.
+static void PlayOut(InlineFrameSet& frameSet, uint16_t& standing, const SkillModel& model,
+                    const SkillRecord& bowler, std::mt19937_64& rng, std::size_t balls = 21) {
+    for (std::size_t i = 0; i < balls && !frameSet.Ended(); ++i) {
+        const auto frame = frameSet.CurrentFrame();
+        const auto after = model.Sample(bowler, standing, rng);
+        frameSet.Bowled(PinSet{after});
+        standing = after == 0 || frameSet.CurrentFrame() != frame ? SkillModel::fullRack : after;
+    }
+}
+
+SCENARIO("Remaining score distributions match the sampler") {
+    GIVEN("A model of two bowlers fitted on random games") {
+        const auto model = FitRandomBowlers(20'000, 41);
+        WHEN("We work out a bowler's final score distribution from the first ball") {
+            const WinProbability engine{model, model.Find(0), model.Find(1)};
+            const auto distribution = engine.FinalScore(0);
+            THEN("It sums to one and its mean matches 20000 sampled games") {
+                double total = 0, mean = 0;
+                for (std::size_t i = 0; i < distribution.size(); ++i) {
+                    total += distribution[i];
+                    mean += i * distribution[i];
+                }
+                CHECK(total == Approx(1).epsilon(1e-9));
+                std::mt19937_64 rng{41};
+                double sampled = 0;
+                for (auto game = 0; game < 20'000; ++game) {
+                    InlineFrameSet frameSet{};
+                    uint16_t standing = SkillModel::fullRack;
+                    PlayOut(frameSet, standing, model, model.Find(0), rng);
+                    sampled += frameSet.Score();
+                }
+                CHECK(sampled / 20'000 == Approx(mean).margin(0.5));
+            }
+        }
+    }
+}
+
+SCENARIO("Win probabilities follow a match ball by ball") {
+    GIVEN("Two bowlers part way through their games") {
+        const auto model = FitRandomBowlers(20'000, 42);
+        const auto& first = model.Find(0);
+        const auto& second = model.Find(1);
+        std::mt19937_64 rng{42};
+        InlineFrameSet firstGame{}, secondGame{};
+        uint16_t firstStanding = SkillModel::fullRack, secondStanding = SkillModel::fullRack;
+        PlayOut(firstGame, firstStanding, model, first, rng, 9);
+        PlayOut(secondGame, secondStanding, model, second, rng, 7);
+        WHEN("We sync the engine to both games") {
+            WinProbability engine{model, first, second};
+            engine.Sync(0, firstGame);
+            engine.Sync(1, secondGame);
+            const auto odds = engine.Current();
+            THEN("The scores match and the odds agree with 20000 playouts") {
+                CHECK(engine.Score(0) == firstGame.Score());
+                CHECK(engine.Score(1) == secondGame.Score());
+                CHECK(odds.first + odds.second + odds.tie == Approx(1));
+                double wins = 0, ties = 0;
+                for (auto match = 0; match < 20'000; ++match) {
+                    auto a = firstGame;
+                    auto b = secondGame;
+                    auto aStanding = firstStanding, bStanding = secondStanding;
+                    PlayOut(a, aStanding, model, first, rng);
+                    PlayOut(b, bStanding, model, second, rng);
+                    wins += a.Score() > b.Score();
+                    ties += a.Score() == b.Score();
+                }
+                CHECK(wins / 20'000 == Approx(odds.first).margin(0.015));
+                CHECK(ties / 20'000 == Approx(odds.tie).margin(0.01));
+            }
+        }
+        WHEN("Both games are finished") {
+            PlayOut(firstGame, firstStanding, model, first, rng);
+            PlayOut(secondGame, secondStanding, model, second, rng);
+            WinProbability engine{model, first, second};
+            engine.Sync(0, firstGame);
+            engine.Sync(1, secondGame);
+            const auto odds = engine.Current();
+            THEN("The odds are certain") {
+                CHECK(odds.first == (firstGame.Score() > secondGame.Score() ? 1 : 0));
+                CHECK(odds.tie == (firstGame.Score() == secondGame.Score() ? 1 : 0));
+                REQUIRE_THROWS_AS(engine.Bowled(0, 0), std::invalid_argument);
+            }
+        }
+    }
+    GIVEN("A fresh match") {
+        const auto model = FitRandomBowlers(2'000, 43);
+        WinProbability engine{model, model.Find(0), model.Find(0)};
+        WHEN("A bowler rolls a strike and then claims 9 more on the same frame") {
+            engine.Bowled(0, 10);
+            THEN("The first ball moves the odds their way and the second is rejected") {
+                CHECK(engine.Current().first > engine.Current().second);
+                engine.Bowled(0, 7);
+                REQUIRE_THROWS_AS(engine.Bowled(0, 9), std::invalid_argument);
+            }
+        }
+    }
+}
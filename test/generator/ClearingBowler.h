@@ -0,0 +1,31 @@
+#ifndef BOWLINGSIMULATOR_CLEARINGBOWLER_H
+#define BOWLINGSIMULATOR_CLEARINGBOWLER_H
+
+#include "Archive.h"
+#include "FrameSet.h"
+#include "Simulation.h"
+#include "SkillModel.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// A bowler who clears a full rack on strikesInTen balls in ten and any other leave
+// on sparesInTen; a ball that does not clear leaves a random subset of the pins
+// standing. Fitted on games of bowler 1.
+inline SkillModel FitClearingBowler(std::size_t games, unsigned strikesInTen, unsigned sparesInTen, uint64_t seed) {
+    std::mt19937_64 rng{seed};
+    std::vector<ArchiveRecord> records(games);
+    for (auto& record : records) {
+        record.bowlerId = 1;
+        InlineFrameSet frameSet{};
+        Simulation::PlayRacks(frameSet, [&](uint16_t standing) {
+            const auto clears = rng() % 10 < (standing == SkillModel::fullRack ? strikesInTen : sparesInTen);
+            const auto after = clears ? uint16_t{0} : static_cast<uint16_t>(standing & rng());
+            record.balls[record.ballCount++] = after;
+            return after;
+        });
+    }
+    return SkillModel::Fit(records, 1);
+}
+#endif //BOWLINGSIMULATOR_CLEARINGBOWLER_H
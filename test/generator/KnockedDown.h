@@ -0,0 +1,13 @@
+#ifndef BOWLINGSIMULATOR_KNOCKEDDOWN_H
+#define BOWLINGSIMULATOR_KNOCKEDDOWN_H
+
+#include "PinSet.h"
+
+#include <cstdint>
+
+// A ball that knocks down the first count pins of a full rack and leaves the rest
+// standing.
+constexpr PinSet KnockedDown(uint_fast8_t count) {
+    return PinSet{static_cast<uint_fast16_t>(~((1u << count) - 1))};
+}
+#endif //BOWLINGSIMULATOR_KNOCKEDDOWN_H
@@ -0,0 +1,164 @@
+#ifndef BOWLINGSIMULATOR_RANDOMGAME_H
+#define BOWLINGSIMULATOR_RANDOMGAME_H
+
+#include "catch.hpp"
+
+#include "ReferenceScorer.h"
+
+#include <cstdint>
+#include <optional>
+#include <sstream>
+#include <vector>
+
+// A complete, legal game: each ball is the mask of pins it leaves standing (the
+// PinSet layout, so it can be passed to FrameSet::Bowled as is) and only ever
+// knocks down pins that were standing, following the Frame and FinalFrame rules
+// as modelled by ReferenceScorer.
+struct RandomGame {
+    std::vector<uint16_t> balls;
+
+    int PinsKnocked() const {
+        ReferenceScorer reference;
+        int total = 0;
+        for (auto i : balls)
+            total += reference.Bowl(i);
+        return total;
+    }
+
+    // Unsigned, as FrameSet::Score is, so the two compare without a cast.
+    uint_fast16_t Score() const {
+        ReferenceScorer reference;
+        for (auto i : balls)
+            reference.Bowl(i);
+        return static_cast<uint_fast16_t>(reference.Score());
+    }
+
+    // Replays the balls keeping only pins that were standing, drops balls after
+    // the end of the game and finishes an unfinished game with gutter balls.
+    RandomGame& Legalize() {
+        ReferenceScorer reference;
+        std::size_t i = 0;
+        for (; i < balls.size() && !reference.Ended(); ++i) {
+            balls[i] &= reference.StandingMask();
+            reference.Bowl(balls[i]);
+        }
+        balls.resize(i);
+        while (!reference.Ended()) {
+            balls.push_back(reference.StandingMask());
+            reference.Bowl(balls.back());
+        }
+        return *this;
+    }
+};
+
+namespace Catch {
+    template<>
+    struct StringMaker<RandomGame> {
+        static std::string convert(const RandomGame& game) {
+            ReferenceScorer reference;
+            std::ostringstream out;
+            out << "{";
+            for (auto i : game.balls)
+                out << " " << reference.Bowl(i);
+            out << " } scoring " << reference.Score();
+            return out.str();
+        }
+    };
+}
+
+// Game i of a generator depends only on the seed and i, so any game can be
+// rebuilt from the two numbers Catch reports.
+class RandomGameGenerator : public Catch::Generators::IGenerator<RandomGame> {
+    uint64_t seed;
+
+    static uint64_t SplitMix(uint64_t& state) {
+        auto z = (state += 0x9E3779B97F4A7C15);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+        return z ^ (z >> 31);
+    }
+
+public:
+    explicit RandomGameGenerator(uint64_t seed) : seed{seed} {
+    }
+
+    auto get(std::size_t index) const -> RandomGame override {
+        auto state = seed ^ (index * 0xD1B54A32D192ED03);
+        RandomGame game;
+        game.balls.reserve(21);
+        ReferenceScorer reference;
+        while (!reference.Ended()) {
+            const auto bits = SplitMix(state);
+            const auto standing = reference.StandingMask();
+            // Strikes, spares and gutters a quarter of the time each keep bonuses and
+            // the tenth frame's third ball coming up often.
+            uint16_t ball;
+            switch (bits & 3) {
+                case 0:
+                    ball = 0;
+                    break;
+                case 1:
+                    ball = standing;
+                    break;
+                default:
+                    ball = static_cast<uint16_t>(standing & (bits >> 8));
+                    break;
+            }
+            game.balls.push_back(ball);
+            reference.Bowl(ball);
+        }
+        return game;
+    }
+};
+
+inline auto randomGames(std::size_t count, uint64_t seed) -> Catch::Generators::Generator<RandomGame> {
+    return Catch::Generators::Generator<RandomGame>(count, std::make_unique<RandomGameGenerator>(seed));
+}
+
+// Greedily simplifies a game for which the property fails: each step makes one
+// ball knock down fewer pins and re-legalizes the rest, and is kept only if the
+// property still fails and the game got simpler (fewer pins knocked, then fewer balls).
+template<typename Property>
+RandomGame Shrink(RandomGame game, Property&& holds) {
+    const auto Simpler = [](const RandomGame& lhs, const RandomGame& rhs) {
+        const auto lhsPins = lhs.PinsKnocked(), rhsPins = rhs.PinsKnocked();
+        return lhsPins < rhsPins || (lhsPins == rhsPins && lhs.balls.size() < rhs.balls.size());
+    };
+    for (auto shrunk = true; shrunk;) {
+        shrunk = false;
+        ReferenceScorer reference;
+        std::vector<uint16_t> standing;
+        for (auto i : game.balls) {
+            standing.push_back(reference.StandingMask());
+            reference.Bowl(i);
+        }
+        for (auto i = game.balls.size(); i-- && !shrunk;) {
+            const uint16_t knocked = standing[i] & ~game.balls[i];
+            for (auto pin = 0; pin < 10 && !shrunk; ++pin) {
+                if (!(knocked & (1u << pin)))
+                    continue;
+                auto candidate = game;
+                candidate.balls[i] |= 1u << pin;
+                candidate.Legalize();
+                if (!holds(candidate) && Simpler(candidate, game)) {
+                    game = std::move(candidate);
+                    shrunk = true;
+                }
+            }
+        }
+    }
+    return game;
+}
+
+// The first game the property fails for, shrunk; nothing if it holds for them all.
+template<typename Property>
+std::optional<RandomGame> FindCounterexample(const Catch::Generators::Generator<RandomGame>& games, Property&& holds) {
+    for (std::size_t i = 0; i < games.size(); ++i) {
+        auto game = games[i];
+        if (!holds(game))
+            return Shrink(std::move(game), holds);
+    }
+    return std::nullopt;
+}
+
+#endif //BOWLINGSIMULATOR_RANDOMGAME_H
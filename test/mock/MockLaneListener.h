@@ -0,0 +1,14 @@
+#ifndef BOWLINGSIMULATOR_MOCKLANELISTENER_H
+#define BOWLINGSIMULATOR_MOCKLANELISTENER_H
+
+#include "interface/ILaneListener.h"
+#include "trompeloeil.hpp"
+
+extern template struct trompeloeil::reporter<trompeloeil::specialized>;
+class MockLaneListener : public ILaneListener {
+public:
+    MAKE_MOCK1(BallBowled, void(const BallEvent&), override);
+    MAKE_MOCK1(FrameEnded, void(const FrameEvent&), override);
+};
+
+#endif //BOWLINGSIMULATOR_MOCKLANELISTENER_H
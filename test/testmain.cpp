@@ -1,3 +1,4 @@
+#define CATCH_CONFIG_NO_POSIX_SIGNALS
 #define CATCH_CONFIG_MAIN
 #include "catch.hpp"
 #include "trompeloeil.hpp"
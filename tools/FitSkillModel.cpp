@@ -0,0 +1,43 @@
+#include "Archive.h"
+#include "SkillModel.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+static int Usage() {
+    std::cerr << "Usage: FitSkillModel <archive> <model> [--threads N]\n";
+    return 2;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3 && argc != 5)
+        return Usage();
+    const std::string archivePath = argv[1], modelPath = argv[2];
+    auto threads = std::max(1u, std::thread::hardware_concurrency());
+    if (argc == 5) {
+        if (std::string{argv[3]} != "--threads")
+            return Usage();
+        try {
+            threads = std::stoul(argv[4]);
+        } catch (const std::logic_error&) {
+            return Usage();
+        }
+    }
+
+    try {
+        const ArchiveReader archive{archivePath};
+        const auto start = std::chrono::steady_clock::now();
+        const auto model = SkillModel::Fit(archive.Records(), threads);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        model.Save(modelPath);
+        std::cout << model.GamesFitted() << " of " << archive.Records().size() << " games fitted for "
+                  << model.Bowlers().size() << " bowlers in " << elapsed.count() << " s ("
+                  << archive.Records().size() / elapsed.count() << " games/s)\n";
+    } catch (const std::runtime_error& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
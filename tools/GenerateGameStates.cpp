@@ -0,0 +1,21 @@
+#include "GameStateSpace.h"
+
+#include <fstream>
+#include <iostream>
+
+// Writes include/GameStateTable.h: GenerateGameStates [output]
+int main(int argc, char** argv) {
+    const GameStateSpace space;
+    std::cerr << space.Size() << " reachable states\n";
+    if (argc < 2) {
+        space.WriteHeader(std::cout);
+        return 0;
+    }
+    std::ofstream out{argv[1]};
+    if (!out) {
+        std::cerr << "Cannot open " << argv[1] << "\n";
+        return 1;
+    }
+    space.WriteHeader(out);
+    return 0;
+}
@@ -0,0 +1,37 @@
+#include "AllocationTracker.h"
+#include "Footprint.h"
+#include "GameArena.h"
+#include "Simulation.h"
+
+#include <iostream>
+#include <string>
+
+// Prints the size and alignment of every engine type, then what one game allocates
+// on each engine, by subsystem. Linked with the allocation hook.
+int main(int argc, char** argv) {
+    const uint_fast64_t games = argc > 1 ? std::stoull(argv[1]) : 10'000;
+
+    std::cout << "type size align\n";
+    for (const auto& type : Footprint::Types())
+        std::cout << type.name << ' ' << type.size << ' ' << type.alignment << '\n';
+    std::cout << "GameArena::BytesPerGame " << GameArena::BytesPerGame() << '\n';
+
+    if (!AllocationTracker::Installed()) {
+        std::cerr << "Allocation hook not linked\n";
+        return 1;
+    }
+    std::cout << "\nengine subsystem allocations/game bytes/game\n";
+    for (const auto engine : {SimulationEngine::HEAP, SimulationEngine::ARENA, SimulationEngine::INLINE}) {
+        const auto stats = Footprint::Games(engine, games);
+        for (std::size_t i = 0; i < AllocationStats::subsystems; ++i) {
+            const auto subsystem = static_cast<Subsystem>(i);
+            if (stats.Allocations(subsystem))
+                std::cout << Simulation::Name(engine) << ", " << AllocationTracker::Name(subsystem) << ", "
+                          << static_cast<double>(stats.Allocations(subsystem)) / games << ", "
+                          << static_cast<double>(stats.Bytes(subsystem)) / games << '\n';
+        }
+        std::cout << Simulation::Name(engine) << ", total, " << static_cast<double>(stats.Allocations()) / games
+                  << ", " << static_cast<double>(stats.Bytes()) / games << '\n';
+    }
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include "Archive.h"
+#include "RescorePipeline.h"
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+static int Usage() {
+    std::cerr << "Usage: RescoreArchive <input> <output> [--diff file.csv] [--engine frameset|batch]\n"
+                 "                      [--decode-threads N] [--score-threads N] [--diff-threads N]\n"
+                 "                      [--chunk records] [--queue chunks] [--in-flight chunks]\n";
+    return 2;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3)
+        return Usage();
+    const std::string inputPath = argv[1], outputPath = argv[2];
+    std::string diffPath;
+
+    // Scoring is the expensive stage, so it gets most of the cores by default.
+    const auto cores = std::max(1u, std::thread::hardware_concurrency());
+    RescorePipeline::Options options;
+    options.decodeThreads = std::max(1u, cores / 8);
+    options.diffThreads = std::max(1u, cores / 8);
+    options.scoreThreads = std::max(1u, cores - options.decodeThreads - options.diffThreads);
+    try {
+        for (auto i = 3; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (i + 1 >= argc)
+                return Usage();
+            const std::string value = argv[++i];
+            if (arg == "--diff")
+                diffPath = value;
+            else if (arg == "--engine" && (value == "frameset" || value == "batch"))
+                options.engine = value == "frameset" ? RescoreEngine::FRAMESET : RescoreEngine::BATCH;
+            else if (arg == "--decode-threads")
+                options.decodeThreads = std::stoul(value);
+            else if (arg == "--score-threads")
+                options.scoreThreads = std::stoul(value);
+            else if (arg == "--diff-threads")
+                options.diffThreads = std::stoul(value);
+            else if (arg == "--chunk")
+                options.chunkRecords = std::stoull(value);
+            else if (arg == "--queue")
+                options.queueCapacity = std::stoull(value);
+            else if (arg == "--in-flight")
+                options.maxChunksInFlight = std::stoull(value);
+            else
+                return Usage();
+        }
+    } catch (const std::logic_error&) {
+        return Usage();
+    }
+
+    options.progress = [](const RescoreProgress& progress) {
+        std::cerr << "\r" << progress.records << "/" << progress.totalRecords << " games, "
+                  << progress.RecordsPerSecond() << " games/s, " << progress.BytesPerSecond() / 1e6 << " MB/s, "
+                  << progress.changed << " changed" << std::flush;
+    };
+
+    try {
+        const ArchiveReader input{inputPath};
+        ArchiveWriter output{outputPath};
+        std::unique_ptr<std::ofstream> diff;
+        if (!diffPath.empty()) {
+            diff = std::make_unique<std::ofstream>(diffPath);
+            *diff << "gameId,bowlerId,storedScore,newScore\n";
+        }
+        const auto result = RescorePipeline{options}.Run(input, output, diff.get());
+        output.Close();
+        std::cerr << "\r" << result.records << " games in " << result.seconds << " s, "
+                  << result.RecordsPerSecond() << " games/s, " << result.BytesPerSecond() / 1e6 << " MB/s\n"
+                  << result.changed << " changed, " << result.invalid << " invalid\n";
+    } catch (const ArchiveException& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include "ShardCoordinator.h"
+#include "Simulation.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+static int Usage() {
+    std::cerr << "Usage: SimulateShards <games> [--workers N] [--chunk GAMES] [--seed S]\n";
+    return 2;
+}
+
+// Plays games on forked worker processes, resuming any that crash, and prints the
+// merged totals and score percentiles.
+int main(int argc, char** argv) {
+    if (argc < 2 || argc % 2 != 0)
+        return Usage();
+    ShardCoordinator::Options options;
+    options.workers = std::max(1u, std::thread::hardware_concurrency());
+    try {
+        options.games = std::stoull(argv[1]);
+        for (auto i = 2; i < argc; i += 2) {
+            const std::string flag = argv[i];
+            if (flag == "--workers")
+                options.workers = std::stoul(argv[i + 1]);
+            else if (flag == "--chunk")
+                options.chunkGames = std::stoull(argv[i + 1]);
+            else if (flag == "--seed")
+                options.seed = std::stoull(argv[i + 1]);
+            else
+                return Usage();
+        }
+    } catch (const std::logic_error&) {
+        return Usage();
+    }
+
+    try {
+        const Simulation simulation;
+        const ShardCoordinator coordinator{simulation, options};
+        const auto start = std::chrono::steady_clock::now();
+        const auto results = coordinator.Run();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << "Games: " << results.totals.games << " in " << coordinator.Chunks() << " chunks on "
+                  << results.shards.size() << " workers, " << elapsed.count() << " s ("
+                  << results.totals.games / elapsed.count() << " games/s)\n";
+        std::cout << "Average Score: " << results.totals.Average() << "\n";
+        std::cout << "Best Score: " << results.totals.best << "\n";
+        std::cout << "Median: " << results.histogram.Percentile(0.5) << ", 99th percentile: "
+                  << results.histogram.Percentile(0.99) << "\n";
+        std::cout << "Restarts: " << results.Restarts() << "\n";
+    } catch (const std::runtime_error& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include "SkillModel.h"
+#include "Sweep.h"
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static int Usage() {
+    std::cerr << "Usage: SweepParameters [--strike D,D...] [--spare D,D...] [--tenth-bonus on|off|both]\n"
+                 "                       [--model <model> --bowler ID] [--simulate GAMES] [--seed S]\n"
+                 "                       [--threads N] [--cache <file>]\n";
+    return 2;
+}
+
+static std::vector<double> ParseList(const std::string& list) {
+    std::vector<double> values;
+    std::istringstream in{list};
+    for (std::string value; std::getline(in, value, ',');)
+        values.push_back(std::stod(value));
+    return values;
+}
+
+// Works out a grid of skill and rule what-ifs and prints the results table as CSV.
+// With --cache, points worked out by an earlier run are read back instead.
+int main(int argc, char** argv) {
+    if (argc % 2 != 1)
+        return Usage();
+    SweepGrid grid;
+    Sweep::Options options;
+    std::string modelPath, cachePath;
+    uint32_t bowlerId = 0;
+    try {
+        for (auto i = 1; i < argc; i += 2) {
+            const std::string flag = argv[i], value = argv[i + 1];
+            if (flag == "--strike")
+                grid.strikeDeltas = ParseList(value);
+            else if (flag == "--spare")
+                grid.spareDeltas = ParseList(value);
+            else if (flag == "--tenth-bonus" && value == "on")
+                grid.tenthFrameBonus = {true};
+            else if (flag == "--tenth-bonus" && value == "off")
+                grid.tenthFrameBonus = {false};
+            else if (flag == "--tenth-bonus" && value == "both")
+                grid.tenthFrameBonus = {true, false};
+            else if (flag == "--model")
+                modelPath = value;
+            else if (flag == "--bowler")
+                bowlerId = std::stoul(value);
+            else if (flag == "--simulate") {
+                options.method = SweepMethod::SIMULATION;
+                options.games = std::stoull(value);
+            } else if (flag == "--seed")
+                options.seed = std::stoull(value);
+            else if (flag == "--threads")
+                options.threads = std::stoul(value);
+            else if (flag == "--cache")
+                cachePath = value;
+            else
+                return Usage();
+        }
+    } catch (const std::logic_error&) {
+        return Usage();
+    }
+
+    try {
+        SkillModel model;
+        if (!modelPath.empty())
+            model = SkillModel::Load(modelPath);
+        const auto sweep = modelPath.empty() ? Sweep{} : Sweep{model, model.Find(bowlerId)};
+        auto cache = cachePath.empty() ? SweepCache{} : SweepCache::Load(cachePath);
+        const auto start = std::chrono::steady_clock::now();
+        const auto results = sweep.Run(grid, options, &cache);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if (!cachePath.empty())
+            cache.Save(cachePath);
+        Sweep::WriteTable(std::cout, results);
+        auto cached = 0;
+        for (const auto& i : results)
+            cached += i.cached;
+        std::cerr << results.size() << " points, " << cached << " from the cache, in " << elapsed.count() << " s\n";
+    } catch (const std::runtime_error& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}